@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "concurrentlist.h"
+
+/// Count of elements of benched list
+const int BENCH_LIST_SIZE = 1 << 20;
+
+/// Max count of reader threads
+const size_t MAX_READER_COUNT = 8;
+
+/// Counts of reader threads
+const size_t READER_COUNTS[] = {1, 2, 4, MAX_READER_COUNT};
+
+/// Time of one measure in nanoseconds
+const long BENCH_TIME = 500000000;
+
+/// Count of concurrentList_get() calls of reader between checks of stop
+const int GET_BATCH_SIZE = 256;
+
+/// State which is shared by threads of one measure
+struct ConcurrentBench {
+  ConcurrentList *list;        /// <- Benched list
+  int             isIteration; /// <- Readers call concurrentList_forEach() instead of concurrentList_get()
+  int             isStopped;   /// <- Threads have to finish
+  size_t          reads;       /// <- Count of elements read by all readers
+  size_t          writes;      /// <- Count of moves of element from front to back by writer
+  long            checksum;    /// <- Sum of read elements, so reads aren`t optimized out
+};
+
+/// Run readers and optional writer for BENCH_TIME
+static void runBench(ConcurrentBench *bench, size_t readerCount, int hasWriter);
+
+/// Read random elements or whole list until bench is stopped
+static void *readList(void *bench);
+
+/// Move front element to back until bench is stopped
+static void *writeList(void *bench);
+
+/// Visitor of concurrentList_forEach() which sums elements
+static void sumElement(void *sum, index_t index, const element_t *element);
+
+int main()
+{
+  int error = 0;
+
+  ConcurrentList list = {};
+
+  initConcurrentList(&list, (size_t)BENCH_LIST_SIZE + 1, &error);
+
+  for (int i = 0; i < BENCH_LIST_SIZE && !error; ++i)
+    if (concurrentList_pushBackElement(&list, &i, &error) == nullindex)
+      return 1;
+
+  if (error)
+    return 1;
+
+  long checksum = 0;
+
+  printf("%-8s %8s %8s %16s %14s\n", "mode", "readers", "writer", "reads M/s", "writes K/s");
+
+  for (int isIteration = 0; isIteration <= 1; ++isIteration)
+    for (int hasWriter = 0; hasWriter <= 1; ++hasWriter)
+      for (size_t readerCount : READER_COUNTS)
+        {
+          ConcurrentBench bench = {
+            .list        = &list,
+            .isIteration = isIteration,
+            .isStopped   = 0,
+            .reads       = 0,
+            .writes      = 0,
+            .checksum    = 0
+          };
+
+          runBench(&bench, readerCount, hasWriter);
+
+          printf("%-8s %8zu %8s %16.2f %14.2f\n", isIteration ? "forEach" : "get", readerCount,
+                 hasWriter ? "yes" : "no", (double)bench.reads / (double)BENCH_TIME * 1e3,
+                 (double)bench.writes / (double)BENCH_TIME * 1e6);
+
+          checksum += bench.checksum;
+        }
+
+  printf("checksum %ld\n", checksum);
+
+  destroyConcurrentList(&list, &error);
+
+  return error ? 1 : 0;
+}
+
+static void runBench(ConcurrentBench *bench, size_t readerCount, int hasWriter)
+{
+  pthread_t readers[MAX_READER_COUNT] = {};
+  pthread_t writer = {};
+
+  for (size_t i = 0; i < readerCount; ++i)
+    pthread_create(&readers[i], nullptr, readList, bench);
+
+  if (hasWriter)
+    pthread_create(&writer, nullptr, writeList, bench);
+
+  timespec delay = {.tv_sec = 0, .tv_nsec = BENCH_TIME};
+
+  nanosleep(&delay, nullptr);
+
+  __atomic_store_n(&bench->isStopped, 1, __ATOMIC_RELAXED);
+
+  for (size_t i = 0; i < readerCount; ++i)
+    pthread_join(readers[i], nullptr);
+
+  if (hasWriter)
+    pthread_join(writer, nullptr);
+}
+
+static void *readList(void *bench)
+{
+  ConcurrentBench *self = (ConcurrentBench *)bench;
+
+  unsigned seed  = (unsigned)(size_t)&seed;
+  size_t   reads = 0;
+  long     sum   = 0;
+
+  while (!__atomic_load_n(&self->isStopped, __ATOMIC_RELAXED))
+    {
+      if (self->isIteration)
+        {
+          concurrentList_forEach(self->list, sumElement, &sum);
+
+          reads += BENCH_LIST_SIZE;
+
+          continue;
+        }
+
+      for (int i = 0; i < GET_BATCH_SIZE; ++i)
+        {
+          element_t element = 0;
+
+          concurrentList_get(self->list, rand_r(&seed) % BENCH_LIST_SIZE + 1, &element);
+
+          sum += element;
+        }
+
+      reads += GET_BATCH_SIZE;
+    }
+
+  __atomic_add_fetch(&self->reads,    reads, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&self->checksum, sum,   __ATOMIC_RELAXED);
+
+  return nullptr;
+}
+
+static void *writeList(void *bench)
+{
+  ConcurrentBench *self = (ConcurrentBench *)bench;
+
+  size_t writes = 0;
+
+  while (!__atomic_load_n(&self->isStopped, __ATOMIC_RELAXED))
+    {
+      element_t element = 0;
+
+      concurrentList_popFrontElement(self->list, &element);
+
+      if (concurrentList_pushBackElement(self->list, &element) == nullindex)
+        break;
+
+      ++writes;
+    }
+
+  __atomic_add_fetch(&self->writes, writes, __ATOMIC_RELAXED);
+
+  return nullptr;
+}
+
+static void sumElement(void *sum, index_t index, const element_t *element)
+{
+  (void)index;
+
+  *(long *)sum += *element;
+}
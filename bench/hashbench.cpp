@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "hash.h"
+#include "settings.h"
+
+/// Sizes of hashed data in bytes
+const size_t BENCH_SIZES[] = {1 << 12, 1 << 16, 1 << 20, 1 << 24};
+
+/// Count of bytes which are hashed for each size
+const size_t BENCH_BYTES = (size_t)1 << 30;
+
+/// Size of Node of List with int elements
+const size_t BENCH_CELL_SIZE = 3*sizeof(int);
+
+const char *const HASH_KIND_NAMES[HASH_KIND_COUNT] = {"byte", "word", "simd", "crc32c"};
+
+/// Current time in seconds
+static double getTime();
+
+/// Hash whole buffer with kind
+/// @return Speed in GB/s
+static double benchBytes(const char *data, size_t size, HashKind kind, hash_t *result);
+
+/// Hash buffer as blocks of cells like data hash tree of List does
+/// @return Speed in GB/s
+static double benchCells(const char *data, size_t size, HashKind kind, hash_t *result);
+
+int main()
+{
+  size_t maxSize = BENCH_SIZES[sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]) - 1];
+
+  char *data = (char *)malloc(maxSize);
+
+  if (!data)
+    return 1;
+
+  srand(1);
+
+  for (size_t i = 0; i < maxSize; ++i)
+    data[i] = (char)rand();
+
+  hash_t result = nullhash;
+
+  printf("%-8s %10s %14s %14s\n", "kind", "size", "bytes GB/s", "cells GB/s");
+
+  for (int kind = 0; kind < HASH_KIND_COUNT; ++kind)
+    for (size_t size : BENCH_SIZES)
+      printf("%-8s %10zu %14.2f %14.2f\n", HASH_KIND_NAMES[kind], size,
+             benchBytes(data, size, (HashKind)kind, &result),
+             benchCells(data, size, (HashKind)kind, &result));
+
+  printf("checksum %X\n", result);
+
+  free(data);
+
+  return 0;
+}
+
+static double getTime()
+{
+  timespec time = {};
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+static double benchBytes(const char *data, size_t size, HashKind kind, hash_t *result)
+{
+  hash_function_t hashFunction = getHashFunction(kind);
+
+  size_t repeats = BENCH_BYTES / size;
+
+  double start = getTime();
+
+  for (size_t i = 0; i < repeats; ++i)
+    *result += hashFunction(data, data + size);
+
+  return (double)(repeats*size) / (getTime() - start) / 1e9;
+}
+
+static double benchCells(const char *data, size_t size, HashKind kind, hash_t *result)
+{
+  size_t blockBytes = BENCH_CELL_SIZE*HASH_BLOCK_SIZE;
+  size_t blocks     = size / blockBytes;
+  size_t repeats    = BENCH_BYTES / size;
+
+  double start = getTime();
+
+  for (size_t i = 0; i < repeats; ++i)
+    for (size_t j = 0; j < blocks; ++j)
+      *result += getCellsHash(data + j*blockBytes, BENCH_CELL_SIZE, HASH_BLOCK_SIZE, j*HASH_BLOCK_SIZE, kind);
+
+  return (double)(repeats*blocks*blockBytes) / (getTime() - start) / 1e9;
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "list.h"
+#include "parallel.h"
+
+/// Sizes of ranked lists, sizes above max size from argument are skipped
+const size_t BENCH_SIZES[] = {1000000, 10000000, 100000000};
+
+/// Max size of ranked list if it isn`t given by argument
+const size_t DEFAULT_MAX_SIZE = 10000000;
+
+/// Min count of threads of parallel ranking, so ruling set is measured on one core too
+const size_t MIN_PARALLEL_THREAD_COUNT = 2;
+
+/// Current time in seconds
+static double getTime();
+
+/// Insert size elements after random Nodes, so order of Nodes is random
+/// @return 0 if list was built else -1
+static int buildShuffledList(List *list, size_t size);
+
+/// Build shuffled list and restore its linearity on threadCount threads
+/// @return Time of list_restoreLinearity() in seconds or -1 if was error
+static double benchRanking(size_t size, size_t threadCount);
+
+int main(int argc, const char *argv[])
+{
+  size_t maxSize = (argc > 1) ? strtoull(argv[1], nullptr, 10) : DEFAULT_MAX_SIZE;
+
+  size_t threadCount = getCoreCount();
+
+  if (threadCount < MIN_PARALLEL_THREAD_COUNT)
+    threadCount = MIN_PARALLEL_THREAD_COUNT;
+
+  printf("%10s %8s %12s %12s %8s\n", "size", "threads", "serial s", "parallel s", "speedup");
+
+  for (size_t size : BENCH_SIZES)
+    {
+      if (size > maxSize)
+        break;
+
+      double serial   = benchRanking(size, 1);
+      double parallel = benchRanking(size, threadCount);
+
+      if (serial < 0 || parallel < 0)
+        return 1;
+
+      printf("%10zu %8zu %12.3f %12.3f %8.2f\n", size, threadCount, serial, parallel, serial / parallel);
+    }
+
+  setParallelThreadCount(0);
+
+  return 0;
+}
+
+static double getTime()
+{
+  timespec time = {};
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+static int buildShuffledList(List *list, size_t size)
+{
+  int error = 0;
+
+  initList(list, size + 1, &error);
+
+  srand(1);
+
+  for (size_t i = 0; i < size && !error; ++i)
+    {
+      element_t element = (element_t)i;
+
+      index_t anchor = i ? (index_t)((size_t)rand() % i) + 1 : nullindex;
+
+      if (list_insertElement(list, anchor, &element, &error) == nullindex)
+        return -1;
+    }
+
+  return error ? -1 : 0;
+}
+
+static double benchRanking(size_t size, size_t threadCount)
+{
+  List list = {};
+
+  if (buildShuffledList(&list, size))
+    {
+      destroyList(&list);
+
+      return -1;
+    }
+
+  setParallelThreadCount(threadCount);
+
+  int error = 0;
+
+  double start = getTime();
+
+  list_restoreLinearity(&list, 0, &error);
+
+  double time = getTime() - start;
+
+  destroyList(&list);
+
+  return error ? -1 : time;
+}
@@ -0,0 +1,127 @@
+#ifndef CONCURRENTLIST_H_
+#define CONCURRENTLIST_H_
+
+#include "list.h"
+
+#include <pthread.h>
+
+struct SlotStack;
+
+/// List which may be used from several threads, readers work in parallel
+/// and writers are serialized by reader-writer lock
+/// @note Waiting writer blocks new readers, so writers aren`t starved by stream of readers
+/// @note Free Nodes for concurrentList_insertSlot() are taken from lock-free pool of slots,
+/// which is refilled from list by SLOT_BATCH_SIZE Nodes under lock for write
+struct ConcurrentList {
+  List list;             /// <- List which is protected by lock
+  pthread_rwlock_t lock; /// <- Many readers or one writer
+  SlotStack *slots;      /// <- Pool of Nodes reserved by list_reserveSlots()
+};
+
+#define initConcurrentList(LIST, CAPACITY, ...)                                   \
+  do_initConcurrentList(LIST, CAPACITY, DEBUG_INFO(LIST) __VA_OPT__(,) __VA_ARGS__);
+
+/// Constructor for concurrent list
+/// @param [in] list ConcurrentList for initilizate
+/// @param [in] capacity Sart capacity for elements
+/// @param [in] info Information about call of this function
+/// @param [in/out] error Variable for save errors` code
+/// @param [in] storage Layout of Nodes in memory
+/// @note Use for init list initConcurrentList()
+void do_initConcurrentList(ConcurrentList *list, size_t capacity, DebugInfo info, int *error = nullptr,
+                           ListStorage storage = LIST_STORAGE_AOS);
+
+/// Destructor for concurrent list
+/// @param [in/out] list ConcurrentList for destroy
+/// @param [in/out] error Variable for save errors` code
+/// @note No other thread may use list during and after call
+void destroyConcurrentList(ConcurrentList *list, int *error = nullptr);
+
+/// Take lock for read and get list for calls of const list functions and iterators
+/// @param [in/out] list ConcurrentList
+/// @return List which mustn`t be changed until concurrentList_unlock()
+const List *concurrentList_lockRead(ConcurrentList *list);
+
+/// Take lock for write and get list for calls of any list functions
+/// @param [in/out] list ConcurrentList
+/// @return List which is used only by calling thread until concurrentList_unlock()
+List *concurrentList_lockWrite(ConcurrentList *list);
+
+/// Release lock which was taken by concurrentList_lockRead() or concurrentList_lockWrite()
+/// @param [in/out] list ConcurrentList
+void concurrentList_unlock(ConcurrentList *list);
+
+/// @see list_insertElement()
+[[nodiscard("Return value need for work with list functions!")]]
+index_t concurrentList_insertElement(ConcurrentList *list, index_t anchor, element_t *element,
+                                     int *error = nullptr);
+
+/// @see list_pushBackElement()
+[[nodiscard("Return value need for work with list functions!")]]
+index_t concurrentList_pushBackElement(ConcurrentList *list, element_t *element, int *error = nullptr);
+
+/// @see list_pushFrontElement()
+[[nodiscard("Return value need for work with list functions!")]]
+index_t concurrentList_pushFrontElement(ConcurrentList *list, element_t *element, int *error = nullptr);
+
+/// Take free Node from pool of slots
+/// @param [in/out] list ConcurrentList
+/// @param [in/out] error Variable for save errors` code
+/// @return Index of Node or nullindex if was error
+/// @note It is lock-free while pool isn`t empty
+[[nodiscard("Return value need for work with list functions!")]]
+index_t concurrentList_allocSlot(ConcurrentList *list, int *error = nullptr);
+
+/// Return Node from concurrentList_allocSlot() to pool of slots
+/// @param [in/out] list ConcurrentList
+/// @param [in] index Index of Node
+/// @param [in/out] error Variable for save errors` code
+/// @note It is lock-free
+void concurrentList_releaseSlot(ConcurrentList *list, index_t index, int *error = nullptr);
+
+/// Insert element to Node from concurrentList_allocSlot() after anchor
+/// @see list_insertSlot()
+void concurrentList_insertSlot(ConcurrentList *list, index_t anchor, index_t index,
+                               const element_t *element, int *error = nullptr);
+
+/// Return all Nodes of pool of slots to free Nodes of list
+/// @param [in/out] list ConcurrentList
+/// @param [in/out] error Variable for save errors` code
+/// @note List is defragmented, sorted and shrunk only without reserved Nodes,
+/// so all slots from concurrentList_allocSlot() have to be inserted or released before
+void concurrentList_flushSlots(ConcurrentList *list, int *error = nullptr);
+
+/// @see list_removeElement()
+element_t *concurrentList_removeElement(ConcurrentList *list, index_t anchor, element_t *element,
+                                        int *error = nullptr);
+
+/// @see list_popBackElement()
+element_t *concurrentList_popBackElement(ConcurrentList *list, element_t *element, int *error = nullptr);
+
+/// @see list_popFrontElement()
+element_t *concurrentList_popFrontElement(ConcurrentList *list, element_t *element, int *error = nullptr);
+
+/// @see list_get()
+/// @note Runs in parallel with other readers
+element_t *concurrentList_get(ConcurrentList *list, index_t anchor, element_t *element,
+                              int *error = nullptr);
+
+/// @see list_getAt()
+/// @note Runs in parallel with other readers
+element_t *concurrentList_getAt(ConcurrentList *list, size_t position, element_t *element,
+                                int *error = nullptr);
+
+/// @see list_size()
+/// @note Runs in parallel with other readers
+size_t concurrentList_size(ConcurrentList *list, int *error = nullptr);
+
+/// Call visitor for each element from head under one lock for read
+/// @param [in/out] list ConcurrentList
+/// @param [in] visitor Function which gets elements, it mustn`t change list
+/// @param [in/out] argument Argument for visitor
+/// @param [in/out] error Variable for save errors` code
+/// @note Runs in parallel with other readers
+void concurrentList_forEach(ConcurrentList *list, list_visitor_t visitor, void *argument,
+                            int *error = nullptr);
+
+#endif
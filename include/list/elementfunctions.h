@@ -1,6 +1,32 @@
-#ifndef ELEMENTFUNCTIONS_H
+#ifndef ELEMENTFUNCTIONS_H_
 #define ELEMENTFUNCTIONS_H_
 
+#include <stdio.h>
+
+/// Functions which list needs from type of its elements
+/// @note Specialization must have static T poison() and static char *toString(const T &element)
+template <typename T>
+struct ElementTraits;
+
+template <>
+struct ElementTraits<int> {
+  /// Value of free cells
+  static int poison()
+  {
+    return -1;
+  }
+
+  /// Element as C-like string in buffer of calling thread
+  static char *toString(const int &element)
+  {
+    static thread_local char buff[16] = "";
+
+    snprintf(buff, sizeof(buff), "%4d", element);
+
+    return buff;
+  }
+};
+
 char *toString(int element);
 
 int getPoison(int element);
@@ -0,0 +1,203 @@
+#ifndef IMAGEGENERATORIMPL_H_
+#define IMAGEGENERATORIMPL_H_
+
+#include "list.h"
+#include "listdump.h"
+
+#include <ctype.h>
+#include <string.h>
+#include <time.h>
+#include "elementfunctions.h"
+#include "liststorage.h"
+#include "asserts.h"
+
+const char *const POISON_COLOR  = "\"#968d78\"";
+const char *const ELEMENT_COLOR = "\"#b59d65\"";
+
+template <typename T, typename IndexT>
+static char *generateDotFile(const BasicList<T, IndexT> *list);
+
+/// Name of next image, images of all lists are numbered by one counter
+inline char *generateNewFileName();
+
+static inline void openDigraph(FILE *file);
+
+static inline void setDefaultNodeParameters(FILE *file);
+
+template <typename T, typename IndexT>
+static void generateNode(const BasicList<T, IndexT> *list, const BasicNode<T, IndexT> *node, size_t index,
+                         FILE *file);
+
+template <typename T, typename IndexT>
+static void generateMainSequence(const BasicList<T, IndexT> *list, FILE *file);
+
+template <typename T, typename IndexT>
+static void generateSequence(const BasicList<T, IndexT> *list, FILE *file);
+
+static inline void closeDigraph(FILE *file);
+
+template <typename T, typename IndexT>
+char *createImage(const BasicList<T, IndexT> *list)
+{
+  assert(list);
+
+  char *dotFileName = generateDotFile(list);
+
+  size_t size = strlen(dotFileName);
+
+  char *command = (char *)calloc(2*size + 16, sizeof(char));
+
+  if (!command)
+    return nullptr;
+
+  int offset = sprintf(command, "dot %s -T png ", dotFileName);
+
+  sprintf(dotFileName + size - 3, "png");
+
+  sprintf(command + offset, "-o %s", dotFileName);
+
+  system(command);
+
+  free(command);
+
+  return dotFileName;
+}
+
+template <typename T, typename IndexT>
+static char *generateDotFile(const BasicList<T, IndexT> *list)
+{
+  assert(list);
+
+  char *fileName = generateNewFileName();
+
+  if (!fileName)
+    return nullptr;
+
+  FILE *file = fopen(fileName, "w");
+
+  if (!file)
+    return nullptr;
+
+  openDigraph(file);
+
+  setDefaultNodeParameters(file);
+
+  for (size_t i = 0; i < list->untouched; ++i)
+    {
+      BasicNode<T, IndexT> node = readNode(list, (IndexT)i);
+
+      generateNode(list, &node, i, file);
+    }
+
+  generateMainSequence(list,file);
+
+  generateSequence(list,file);
+
+  closeDigraph(file);
+
+  fclose(file);
+
+  return fileName;
+}
+
+inline char *generateNewFileName()
+{
+  time_t now = 0;
+  time(&now);
+  char dataString[32] = "";
+  ctime_r(&now, dataString);
+
+  int i = 0;
+
+  for ( ; dataString[i]; ++i)
+    if (isspace(dataString[i]) || ispunct(dataString[i]))
+      dataString[i] = '_';
+
+  dataString[i - 1] = '\0';
+
+  static char buff[64] = "";
+
+  static int imageCount = 0;
+
+  sprintf(buff, ".log/image_%s_%10.10d.dot", dataString, imageCount++);
+
+  return buff;
+}
+
+static inline void openDigraph(FILE *file)
+{
+  fprintf(file, "digraph {\n");
+}
+
+static inline void setDefaultNodeParameters(FILE *file)
+{
+  fprintf(file, "\tsplines=ortho;\n");
+  fprintf(file, "\trankdir=LR;\n");
+  fprintf(file, "\tnode[shape=Mrecord];\n");
+  fprintf(file, "\tedge[color=\"#00000000\"];\n");
+}
+
+template <typename T, typename IndexT>
+static void generateNode(const BasicList<T, IndexT> *list, const BasicNode<T, IndexT> *node, size_t index,
+                         FILE *file)
+{
+  T poison = ElementTraits<T>::poison();
+
+  fprintf(
+          file,
+          "\t\tNODE_%08zu [ style=filled,color=%s,label=\""
+          " %s%zu | "
+          " Elem: %s |"
+          " Next: %4lld | Prev: %lld"
+          "\" ];\n",
+          index,
+          !memcmp(&poison, &node->elem, sizeof(T)) ? POISON_COLOR : ELEMENT_COLOR,
+          ((IndexT)index == list_head(list)) ? "Head:" : ((IndexT)index == list->free) ? "Free:" : "",
+          index,
+          ElementTraits<T>::toString(node->elem),
+          (long long)node->next,
+          (long long)node->prev
+          );
+}
+
+template <typename T, typename IndexT>
+static void generateMainSequence(const BasicList<T, IndexT> *list, FILE *file)
+{
+  for (size_t i = 0; i + 1 < list->untouched; ++i)
+    fprintf(file, "\tNODE_%08zu->NODE_%08zu [ weight=300 ];\n", i, i + 1);
+}
+
+template <typename T, typename IndexT>
+static void generateSequence(const BasicList<T, IndexT> *list, FILE *file)
+{
+
+  IndexT curr = list_head(list);
+
+  fprintf(file, "\tedge[color=\"RED\"];\n");
+
+  for (int i = 0; i < (int)list->size - 1; ++i, curr = list_next(list, curr))
+    fprintf(file, "\tNODE_%08lld->NODE_%08lld [ weight=10 ];\n", (long long)curr,
+            (long long)list_next(list, curr));
+
+  fprintf(file, "\tedge[color=\"BLUE\"];\n");
+
+  for (int i = 0; i < (int)list->size - 1; ++i, curr = list_prev(list, curr))
+    fprintf(file, "\tNODE_%08lld->NODE_%08lld [ weight=10 ];\n", (long long)curr,
+            (long long)list_prev(list, curr));
+
+  curr = list->free;
+
+  fprintf(file, "\tedge[color=\"GREEN\"];\n");
+
+  for (size_t i = 0; i < list->untouched && curr != nullindex && list_next(list, curr) != nullindex;
+       ++i, curr = list_next(list, curr))
+    fprintf(file, "\tNODE_%08lld->NODE_%08lld [ weight=10 ];\n", (long long)curr,
+            (long long)list_next(list, curr));
+}
+
+static inline void closeDigraph(FILE *file)
+{
+  fprintf(file, "}");
+}
+
+#endif
@@ -6,34 +6,156 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <stdarg.h>
+#include <type_traits>
 
 #include "debuginfo.h"
 #include "canary.h"
 #include "hash.h"
 
-/// Node for List
-struct Node {
-  element_t elem; /// <- Element which contains in it
-  index_t   next; /// <- Index of next Node
-  index_t   prev; /// <- Index of previous Node
+/// Node for BasicList
+/// @note Nodes are hashed and saved by their bytes, so T mustn`t have padding
+template <typename T, typename IndexT>
+struct BasicNode {
+  T      elem; /// <- Element which contains in it
+  IndexT next; /// <- Index of next Node
+  IndexT prev; /// <- Index of previous Node
 };
 
-/// Chahe-friendly List
-struct List {
+/// Comparator of elements like for qsort()
+template <typename T>
+using basic_element_compare_t = int (*)(const T *first, const T *second);
+
+/// Function which gets new index of element moved by list_defragStep()
+template <typename IndexT>
+using basic_list_relocation_t = void (*)(void *argument, IndexT oldIndex, IndexT newIndex);
+
+/// Function which gets elements of list by list_parallelForEach() or concurrentList_forEach()
+template <typename T, typename IndexT>
+using basic_list_visitor_t = void (*)(void *argument, IndexT index, const T *element);
+
+/// Function which changes elements of list by list_parallelTransform()
+template <typename T, typename IndexT>
+using basic_list_transform_t = void (*)(void *argument, IndexT index, T *element);
+
+/// Node of List
+typedef BasicNode<element_t, index_t> Node;
+
+typedef basic_element_compare_t<element_t> element_compare_t;
+
+typedef basic_list_relocation_t<index_t> list_relocation_t;
+
+typedef basic_list_visitor_t<element_t, index_t> list_visitor_t;
+
+typedef basic_list_transform_t<element_t, index_t> list_transform_t;
+
+/// Layouts of Nodes in memory of List
+enum ListStorage {
+  LIST_STORAGE_AOS = 0, /// <- Nodes in one array List::data
+  LIST_STORAGE_SOA = 1, /// <- Fields of Nodes in separate arrays List::elems, List::nexts and List::prevs
+  LIST_STORAGE_CHUNKED = 2, /// <- Nodes in chunks of STORAGE_CHUNK_SIZE in List::chunks, growth adds chunks
+                            ///    and doesn`t move Nodes
+};
+
+template <typename IndexT>
+struct BasicOrderIndex;
+
+struct ListJournal;
+
+/// Rules of automatic change of capacity of BasicList
+/// @note Shrink makes capacity about size*growthFactor, so shrinkLoad*growthFactor
+/// must be less than 1 for list isn`t resized back and forth
+template <typename IndexT>
+struct BasicListCapacityPolicy {
+  double growthFactor; /// <- Capacity is multiplied by it when list is full, more than 1
+  double shrinkLoad;   /// <- List is shrunk when size is less than shrinkLoad*capacity, 0 for never
+  size_t minCapacity;  /// <- Capacity which list isn`t shrunk below
+  basic_list_relocation_t<IndexT> relocation; /// <- Function which gets indexes of elements moved by shrink
+                                              ///    or nullptr
+  void *argument;      /// <- Argument for relocation
+};
+
+typedef BasicListCapacityPolicy<index_t> ListCapacityPolicy;
+
+/// BasicListCapacityPolicy which set to list in initList(), list is never shrunk
+template <typename IndexT>
+const BasicListCapacityPolicy<IndexT> BASIC_DEFAULT_CAPACITY_POLICY = {
+  .growthFactor = 2,
+  .shrinkLoad   = 0,
+  .minCapacity  = 0,
+  .relocation   = nullptr,
+  .argument     = nullptr
+};
+
+/// ListCapacityPolicy which set to List in initList(), list is never shrunk
+const ListCapacityPolicy DEFAULT_CAPACITY_POLICY = BASIC_DEFAULT_CAPACITY_POLICY<index_t>;
+
+/// Rules of write-ahead journal of List
+struct ListJournalPolicy {
+  size_t groupSize;      /// <- Count of records which are written to file by one write, 1 for each record
+  size_t syncPeriod;     /// <- Count of writes after which fsync() is made, 0 for only explicit syncs
+  size_t checkpointSize; /// <- Size of journal file after which list is saved and journal is cleared,
+                         ///    0 for only explicit checkpoints
+};
+
+/// ListJournalPolicy where each group of 64 records is synced, journal is at most about 64 MB
+const ListJournalPolicy DEFAULT_JOURNAL_POLICY = {
+  .groupSize      = 64,
+  .syncPeriod     = 1,
+  .checkpointSize = 1 << 26
+};
+
+/// Chahe-friendly list of elements T with indexes IndexT
+/// @note ElementTraits<T> must be specialized, IndexT must be signed because free Nodes keep
+/// negative links
+template <typename T, typename IndexT>
+struct BasicList {
+  static_assert(std::is_signed_v<IndexT>, "Free Nodes keep negative indexes");
+  static_assert(sizeof(BasicNode<T, IndexT>) == sizeof(T) + 2*sizeof(IndexT),
+                "Nodes are hashed by bytes, so they mustn`t have padding");
+
 #ifdef NEED_CANARY_
 
   canary_t leftCanary; /// <- Left struct canary for check intervention
 
 #endif
 
-  Node *data;       /// <- Dimanic allocate array with Nodes
+  BasicNode<T, IndexT> *data;  /// <- Dimanic allocate array with Nodes for LIST_STORAGE_AOS
+
+  T      *elems; /// <- Dimanic allocate array with elements of Nodes for LIST_STORAGE_SOA
+  IndexT *nexts; /// <- Dimanic allocate array with next indexes of Nodes for LIST_STORAGE_SOA
+  IndexT *prevs; /// <- Dimanic allocate array with previous indexes of Nodes for LIST_STORAGE_SOA
+
+  BasicNode<T, IndexT> **chunks; /// <- Dimanic allocate array of chunks of Nodes for LIST_STORAGE_CHUNKED
+
+  void  *file;      /// <- Mapping of file which List::data points into or nullptr
+  size_t fileSize;  /// <- Size of mapping of file
+
+  BasicOrderIndex<IndexT> *orderIndex; /// <- Tree of positions of Nodes or nullptr if it is disabled
+
+  ListJournal *journal; /// <- Write-ahead journal of changes or nullptr if it is disabled
+
+  BasicListCapacityPolicy<IndexT> policy; /// <- Rules of automatic change of capacity
+
   size_t capacity;  /// <- Capacity of data
   size_t size;      /// <- Count of elements in data
-  index_t free;     /// <- Index of first free cell in free sequence which contains in data
+
+  size_t defragPosition; /// <- Count of first elements which are known to be in Nodes from 1
+  size_t untouched;      /// <- Index of first never used Node, Nodes from it are free out of free sequence
+  size_t reserved;       /// <- Count of Nodes taken by list_reserveSlots(), they are neither elements nor free
+  IndexT free;      /// <- Index of first free cell in free sequence which contains in data
+
+  int validationLevel; /// <- ListValidationLevel which used by validateList(list)
+  int storage;         /// <- ListStorage of Nodes
+  int isLinear;        /// <- Is k-th element in Node k, so position is index - 1
 
 #ifdef NEED_HASH_
 
-  hash_t dataHash; /// <- Hash of data from .data to .data + .capacity
+  hash_t *hashTree;      /// <- Tree of sums of Nodes` hashes, leaf is block of HASH_BLOCK_SIZE Nodes
+  size_t hashTreeLeaves; /// <- Count of leaves in hashTree, root is hashTree[1]
+
+  int hashKind; /// <- HashKind of function for Nodes and this struct
+
+  hash_t dataHash; /// <- Sum of hashes of Nodes from .data to .data + .untouched, equal to root of hashTree
   hash_t hash;     /// <- Hash of this struct from ::leftCanary to ::hash
 
 #endif
@@ -51,6 +173,9 @@ struct List {
 #endif
 };
 
+/// List of element_t with index_t indexes which is used by iterators, streams and wrappers of list
+typedef BasicList<element_t, index_t> List;
+
 /// Abstract List iterator
 struct ListIterator
 {
@@ -64,6 +189,33 @@ struct MutableListIterator : public ListIterator {};
 /// Const List iterator
 struct ConstListIterator   : public ListIterator {};
 
+/// Max size of one record of List stream in bytes
+const size_t LIST_STREAM_MAX_RECORD = 10;
+
+/// State of write of List stream, stream is varint of count of elements and
+/// zigzag varints of differences between neighbour elements in logical order
+/// @note List mustn`t be changed while it is written
+struct ListWriter
+{
+  const List *list;   /// <- List which is written
+  index_t current;    /// <- Index of next written element
+  element_t last;     /// <- Last written element
+  int isCountWritten; /// <- Is count of elements written
+};
+
+/// State of read of List stream which appends elements to tail of List
+struct ListReader
+{
+  List *list;               /// <- List which gets elements
+  size_t count;             /// <- Count of elements in stream
+  size_t read;              /// <- Count of read elements
+  element_t last;           /// <- Last read element
+  unsigned long long value; /// <- Bits of varint which is read now
+  unsigned shift;           /// <- Count of read bits of varint
+  int isCountRead;          /// <- Is count of elements read
+  int isFinished;           /// <- Is all stream read
+};
+
 /// Errors` codes which may be return from next functions
 enum ListError {
   LIST_NULL_POINTER            = 0x01 <<  0,
@@ -80,29 +232,114 @@ enum ListError {
   LIST_BROKEN_DATA_HASH        = 0x01 << 11,
   LIST_NOT_FREE                = 0x01 << 12,
   LIST_FREE_SEQUENCE_IS_BROKEN = 0x01 << 13,
+  LIST_MAIN_SEQUENCE_IS_BROKEN = 0x01 << 14,
 };
 
 /// Count of errors
-const int ERROR_COUNT = 14;
+const int ERROR_COUNT = 15;
+
+/// Levels of checks which do validateList()
+enum ListValidationLevel {
+  LIST_VALIDATE_NONE = 0, /// <- Only check pointer to list
+  LIST_VALIDATE_FAST = 1, /// <- O(1) check of fields, canaries, hash of struct and root of data hash tree
+  LIST_VALIDATE_HASH = 2, /// <- LIST_VALIDATE_FAST and O(capacity) rehash of all blocks of data,
+                          ///    only for debugging because it is done on each call of list functions
+  LIST_VALIDATE_DEEP = 3, /// <- LIST_VALIDATE_HASH and O(capacity) walks of main and free sequences,
+                          ///    other Nodes below List::untouched must be reserved
+};
+
+/// Node in chunk of LIST_STORAGE_CHUNKED
+template <typename T, typename IndexT>
+inline BasicNode<T, IndexT> *list_chunkNode(const BasicList<T, IndexT> *list,
+                                            std::type_identity_t<IndexT> index)
+{
+  return &list->chunks[(size_t)index >> STORAGE_CHUNK_SHIFT][(size_t)index & (STORAGE_CHUNK_SIZE - 1)];
+}
+
+/// Index of next Node
+template <typename T, typename IndexT>
+inline IndexT list_next(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return list->nexts[index];
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return list_chunkNode(list, index)->next;
+
+  return list->data[index].next;
+}
+
+/// Index of previous Node
+template <typename T, typename IndexT>
+inline IndexT list_prev(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return list->prevs[index];
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return list_chunkNode(list, index)->prev;
+
+  return list->data[index].prev;
+}
+
+/// Pointer to element of Node
+template <typename T, typename IndexT>
+inline T *list_element(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return &list->elems[index];
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return &list_chunkNode(list, index)->elem;
+
+  return &list->data[index].elem;
+}
+
+/// Pointer to element of Node
+template <typename T, typename IndexT>
+inline const T *list_element(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return &list->elems[index];
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return &list_chunkNode(list, index)->elem;
 
-inline index_t list_head(const List *list)
+  return &list->data[index].elem;
+}
+
+template <typename T, typename IndexT>
+inline IndexT list_head(const BasicList<T, IndexT> *list)
 {
-  return list->data[nullindex].next;
+  return list_next(list, nullindex);
 }
 
-inline index_t list_tail(const List *list)
+template <typename T, typename IndexT>
+inline IndexT list_tail(const BasicList<T, IndexT> *list)
 {
-  return list->data[nullindex].prev;
+  return list_prev(list, nullindex);
 }
 
-inline void set_head(List *list, index_t newHead)
+template <typename T, typename IndexT>
+inline void set_head(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> newHead)
 {
-  list->data[nullindex].next = newHead;
+  if (list->storage == LIST_STORAGE_SOA)
+    list->nexts[nullindex] = newHead;
+  else if (list->storage == LIST_STORAGE_CHUNKED)
+    list_chunkNode(list, nullindex)->next = newHead;
+  else
+    list->data[nullindex].next = newHead;
 }
 
-inline void set_tail(List *list, index_t newTail)
+template <typename T, typename IndexT>
+inline void set_tail(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> newTail)
 {
-  list->data[nullindex].prev = newTail;
+  if (list->storage == LIST_STORAGE_SOA)
+    list->prevs[nullindex] = newTail;
+  else if (list->storage == LIST_STORAGE_CHUNKED)
+    list_chunkNode(list, nullindex)->prev = newTail;
+  else
+    list->data[nullindex].prev = newTail;
 }
 
 /// Create Mutable List iterator from head
@@ -157,12 +394,68 @@ index_t index(ListIterator *iter);
 /// @return Pointer to element in list
 const element_t *value(ConstListIterator   *iter);
 
+/// Create writer of list stream from head
+/// @param [in] list List
+/// @return ListWriter
+ListWriter list_getWriter(const List *list);
+
+/// Write next part of list stream to buffer
+/// @param [in/out] writer Writer
+/// @param [out] buffer Buffer
+/// @param [in] size Size of buffer, not less than LIST_STREAM_MAX_RECORD
+/// @param [in/out] error Variable for save errors` code
+/// @return Count of written bytes, 0 if all stream is written
+size_t list_writeChunk(ListWriter *writer, void *buffer, size_t size, int *error = nullptr);
+
+/// Write list stream to file descriptor
+/// @param [in] list List
+/// @param [in] fileDescriptor File descriptor
+/// @param [in/out] error Variable for save errors` code
+void list_writeToFd(const List *list, int fileDescriptor, int *error = nullptr);
+
+/// Create reader of list stream to tail of list
+/// @param [in/out] list List
+/// @return ListReader
+ListReader list_getReader(List *list);
+
+/// Read next part of list stream from buffer and push elements back to list
+/// @param [in/out] reader Reader
+/// @param [in] buffer Buffer with part of stream
+/// @param [in] size Size of buffer
+/// @param [in/out] error Variable for save errors` code
+/// @return Count of read bytes, less than size only if stream is finished
+/// @note Elements are written by one list_pushBackRange(), so empty list stays linear
+size_t list_readChunk(ListReader *reader, const void *buffer, size_t size, int *error = nullptr);
+
+/// Read list stream from file descriptor and push elements back to list
+/// @param [in/out] list List
+/// @param [in] fileDescriptor File descriptor
+/// @param [in/out] error Variable for save errors` code
+/// @note Bytes after end of stream may be read from file descriptor and lost
+void list_readFromFd(List *list, int fileDescriptor, int *error = nullptr);
+
+/// Check List to error with level which set in list
+/// @param [in] list List for validate
+/// @return Errors` code
+/// @note Level is set by list_setValidationLevel(), default level is O(1)
+template <typename T, typename IndexT>
+unsigned validateList(const BasicList<T, IndexT> *list);
+
 /// Check List to error
 /// @param [in] list List for validate
-/// @param [in] deep Need check deep
+/// @param [in] level Level of checks
 /// @return Errors` code
+/// @note Level is clamped to MAX_VALIDATION_LEVEL_
 /// @note Deep validate takes much time
-unsigned validateList(const List *list);
+template <typename T, typename IndexT>
+unsigned validateList(const BasicList<T, IndexT> *list, ListValidationLevel level);
+
+/// Set level of checks which will be done on each call of list functions
+/// @param [in/out] list List
+/// @param [in] level Level of checks
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_setValidationLevel(BasicList<T, IndexT> *list, ListValidationLevel level, int *error = nullptr);
 
 #define initList(LIST, CAPACITY, ...)                                   \
   do_initList(LIST, CAPACITY, DEBUG_INFO(LIST) __VA_OPT__(,) __VA_ARGS__);
@@ -172,42 +465,283 @@ unsigned validateList(const List *list);
 /// @param [in] capacity Sart capacity for elements
 /// @param [in] info Information about call of this function
 /// @param [in/out] error Variable for save errors` code
+/// @param [in] storage Layout of Nodes in memory
 /// @note Use for init list initList()
-void do_initList(List *list, size_t capacity, DebugInfo info, int *error = nullptr);
+template <typename T, typename IndexT>
+void do_initList(BasicList<T, IndexT> *list, size_t capacity, DebugInfo info, int *error = nullptr,
+                 ListStorage storage = LIST_STORAGE_AOS);
 
 /// Destructor for list
 /// @param list List for destroy
 /// @param [in/out] error Variable for save errors` code
-void destroyList(List *list, int *error = nullptr);
+template <typename T, typename IndexT>
+void destroyList(BasicList<T, IndexT> *list, int *error = nullptr);
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_insertElement(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                          std::type_identity_t<T> *element, int *error = nullptr);
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushBackElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element,
+                            int *error = nullptr);
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushFrontElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element,
+                             int *error = nullptr);
+
+/// Insert count elements after anchor with one validation, one growth and one hash update
+/// @param [in/out] list List
+/// @param [in] anchor Index of Node after which elements are inserted
+/// @param [in] elements Array of elements in order of insert
+/// @param [in] count Count of elements
+/// @param [in/out] error Variable for save errors` code
+/// @return Index of first inserted element or nullindex if count is 0
+/// @note Next inserted elements are in next free cells, for resized list they go one by one
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_insertRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                        const std::type_identity_t<T> *elements, size_t count, int *error = nullptr);
 
+/// Insert count elements to end of list
+/// @see list_insertRange()
+template <typename T, typename IndexT>
 [[nodiscard("Return value need for work with list functions!")]]
-index_t list_insertElement(List *list, index_t anchor, element_t *element, int *error = nullptr);
+IndexT list_pushBackRange(BasicList<T, IndexT> *list, const std::type_identity_t<T> *elements, size_t count,
+                          int *error = nullptr);
 
+/// Insert count elements to begin of list
+/// @see list_insertRange()
+template <typename T, typename IndexT>
 [[nodiscard("Return value need for work with list functions!")]]
-index_t list_pushBackElement(List *list, element_t *element, int *error = nullptr);
+IndexT list_pushFrontRange(BasicList<T, IndexT> *list, const std::type_identity_t<T> *elements, size_t count,
+                           int *error = nullptr);
 
+/// Take free Nodes out of list for list_insertSlot() and list_releaseSlot()
+/// @param [in/out] list List
+/// @param [out] indexes Array for indexes of count taken Nodes
+/// @param [in] count Count of Nodes
+/// @param [in/out] error Variable for save errors` code
+/// @note While list has reserved Nodes it isn`t shrunk, list_defragStep(), list_sort(),
+/// list_restoreLinearity(), list_saveToFile() and journal fail
+template <typename T, typename IndexT>
+void list_reserveSlots(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> *indexes, size_t count,
+                       int *error = nullptr);
+
+/// Insert element to reserved Node after anchor
+/// @param [in/out] list List
+/// @param [in] anchor Index of Node after which element is inserted
+/// @param [in] index Index of Node from list_reserveSlots()
+/// @param [in] element Element
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_insertSlot(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                     std::type_identity_t<IndexT> index, const std::type_identity_t<T> *element,
+                     int *error = nullptr);
+
+/// Return reserved Node to free Nodes of list
+/// @param [in/out] list List
+/// @param [in] index Index of Node from list_reserveSlots()
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_releaseSlot(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index, int *error = nullptr);
+
+/// Move elements from first to last of source after anchor of destination
+/// @param [in/out] destination List to which elements are moved
+/// @param [in] anchor Index of Node of destination after which elements are moved
+/// @param [in/out] source List from which elements are moved
+/// @param [in] first Index of first moved element in source
+/// @param [in] last Index of last moved element in source
+/// @param [in/out] error Variable for save errors` code
+/// @return Index of first moved element in destination
+/// @note For one list it is list_moveRange() and indexes don`t change,
+/// else time is proportional to count of moved elements
+template <typename T, typename IndexT>
 [[nodiscard("Return value need for work with list functions!")]]
-index_t list_pushFrontElement(List *list, element_t *element, int *error = nullptr);
+IndexT list_splice(BasicList<T, IndexT> *destination, std::type_identity_t<IndexT> anchor,
+                   BasicList<T, IndexT> *source, std::type_identity_t<IndexT> first,
+                   std::type_identity_t<IndexT> last, int *error = nullptr);
+
+/// Move elements from first to last after anchor of the same list
+/// @param [in/out] list List
+/// @param [in] first Index of first moved element
+/// @param [in] last Index of last moved element
+/// @param [in] anchor Index of Node after which elements are moved
+/// @param [in/out] error Variable for save errors` code
+/// @note It is error if anchor is in range from first to last or last is before first.
+/// Check takes O(log(size)) with order index and O(1) for linear list, else range is walked,
+/// move itself is O(1)
+template <typename T, typename IndexT>
+void list_moveRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                    std::type_identity_t<IndexT> last, std::type_identity_t<IndexT> anchor,
+                    int *error = nullptr);
+
+/// Move elements after anchor to end of other list
+/// @param [in/out] list List which is cut
+/// @param [in] anchor Index of last element which stays in list, nullindex for move all
+/// @param [in/out] newList Initialized list which gets elements
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_split(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                BasicList<T, IndexT> *newList, int *error = nullptr);
+
+/// Stable sort of list which leaves it linear like list_restoreLinearity()
+/// @param [in/out] list List
+/// @param [in] compare Comparator of elements
+/// @param [in/out] error Variable for save errors` code
+/// @note List with PARALLEL_SORT_MIN_SIZE or more elements is sorted on getParallelThreadCount() threads
+/// @note Nodes are relinked by merge sort and then swapped to their positions in place,
+/// so extra memory doesn`t depend on size of list
+/// @note Indexes of elements are changed
+template <typename T, typename IndexT>
+void list_sort(BasicList<T, IndexT> *list, std::type_identity_t<basic_element_compare_t<T>> compare,
+               int *error = nullptr);
+
+/// Call visitor for each element on all CPU cores
+/// @param [in] list List
+/// @param [in] visitor Function which gets elements, it is called from several threads at once
+/// @param [in/out] argument Argument for visitor
+/// @param [in/out] error Variable for save errors` code
+/// @note List is split to chunks of PARALLEL_CHUNK_SIZE elements: by indexes for linear list,
+/// else by one walk from head, chunks are done on threads which steal chunks from each other
+/// @note Order of calls isn`t defined, list is validated only before calls
+template <typename T, typename IndexT>
+void list_parallelForEach(const BasicList<T, IndexT> *list,
+                          std::type_identity_t<basic_list_visitor_t<T, IndexT>> visitor, void *argument,
+                          int *error = nullptr);
+
+/// Change each element on all CPU cores
+/// @param [in/out] list List
+/// @param [in] transform Function which changes element, it is called from several threads at once
+/// @param [in/out] argument Argument for transform
+/// @param [in/out] error Variable for save errors` code
+/// @note Chunks are like in list_parallelForEach(), hashes of changed Nodes are updated by threads,
+/// journal gets checkpoint
+template <typename T, typename IndexT>
+void list_parallelTransform(BasicList<T, IndexT> *list,
+                            std::type_identity_t<basic_list_transform_t<T, IndexT>> transform, void *argument,
+                            int *error = nullptr);
+
+/// Merge sorted source to sorted destination, source becomes empty
+/// @param [in/out] destination Sorted list which gets elements
+/// @param [in/out] source Sorted list which gives elements
+/// @param [in] compare Comparator of elements
+/// @param [in/out] error Variable for save errors` code
+/// @note Indexes of elements of destination don`t change, equal elements of
+/// destination stay before elements of source
+template <typename T, typename IndexT>
+void list_merge(BasicList<T, IndexT> *destination, BasicList<T, IndexT> *source,
+                std::type_identity_t<basic_element_compare_t<T>> compare, int *error = nullptr);
 
-element_t *list_removeElement(List *list, index_t anchor, element_t *element, int *error = nullptr);
+template <typename T, typename IndexT>
+T *list_removeElement(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                      std::type_identity_t<T> *element, int *error = nullptr);
 
-element_t *list_popBackElement(List *list, element_t *element, int *error = nullptr);
+template <typename T, typename IndexT>
+T *list_popBackElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error = nullptr);
 
-element_t *list_popFrontElement(List *list, element_t *element, int *error = nullptr);
+template <typename T, typename IndexT>
+T *list_popFrontElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error = nullptr);
 
-element_t *list_get(const List *list, index_t anchor, element_t *element, int *error = nullptr);
+template <typename T, typename IndexT>
+T *list_get(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+            std::type_identity_t<T> *element, int *error = nullptr);
 
 /// Get list size of sequence in data
 /// @param [in] list List
 /// @param [in/out] error Variable for save errors` code
 /// @return Size of sequence in .data
-size_t list_size(const List *list, int *error = nullptr);
+template <typename T, typename IndexT>
+size_t list_size(const BasicList<T, IndexT> *list, int *error = nullptr);
+
+/// Index of element at position
+/// @param [in] list List
+/// @param [in] position Position of element from 0
+/// @param [in/out] error Variable for save errors` code
+/// @return Index of element or nullindex if position isn`t less than size
+/// @note O(1) for linear list, O(log(size)) with order index, else walk from nearest end of list
+template <typename T, typename IndexT>
+IndexT list_indexOf(const BasicList<T, IndexT> *list, size_t position, int *error = nullptr);
+
+/// Get element at position
+/// @param [in] list List
+/// @param [in] position Position of element from 0
+/// @param [out] element Variable for element
+/// @param [in/out] error Variable for save errors` code
+/// @return element or nullptr if was error
+/// @see list_indexOf()
+template <typename T, typename IndexT>
+T *list_getAt(const BasicList<T, IndexT> *list, size_t position, std::type_identity_t<T> *element,
+              int *error = nullptr);
+
+/// Position of element
+/// @param [in] list List
+/// @param [in] index Index of element
+/// @param [in/out] error Variable for save errors` code
+/// @return Position of element from 0
+/// @note O(1) for linear list, O(log(size)) with order index, else walk from head
+template <typename T, typename IndexT>
+size_t list_positionOf(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                       int *error = nullptr);
+
+/// Set rules of automatic change of capacity
+/// @param [in/out] list List
+/// @param [in] policy Rules
+/// @param [in/out] error Variable for save errors` code
+/// @note Shrink moves elements from Nodes above new capacity to free Nodes below it
+/// and reports them to ListCapacityPolicy::relocation, other indexes don`t change
+template <typename T, typename IndexT>
+void list_setCapacityPolicy(BasicList<T, IndexT> *list,
+                            std::type_identity_t<BasicListCapacityPolicy<IndexT>> policy,
+                            int *error = nullptr);
+
+/// Move at most budget elements to their Nodes in linear order
+/// @param [in/out] list List
+/// @param [in] budget Max count of checked elements, each takes O(1)
+/// @param [in] relocation Function which is called for each moved element or nullptr
+/// @param [in/out] argument Argument for relocation
+/// @param [in/out] error Variable for save errors` code
+/// @return Count of elements which may be not in their Nodes yet, 0 if list is linear
+/// @note Unlike list_restoreLinearity() it doesn`t alloc memory and changes only
+/// indexes which are reported to relocation in order of moves, so it may be called
+/// step by step between other list functions
+/// @note Element is moved only to free cell, so list without free cells isn`t changed
+template <typename T, typename IndexT>
+size_t list_defragStep(BasicList<T, IndexT> *list, size_t budget,
+                       std::type_identity_t<basic_list_relocation_t<IndexT>> relocation = nullptr,
+                       void *argument = nullptr, int *error = nullptr);
+
+/// Move elements to their Nodes in linear order until time budget is spent
+/// @param [in/out] list List
+/// @param [in] timeBudget Time of moves in nanoseconds
+/// @param [in] relocation Function which is called for each moved element or nullptr
+/// @param [in/out] argument Argument for relocation
+/// @param [in/out] error Variable for save errors` code
+/// @return Count of elements which may be not in their Nodes yet, 0 if list is linear
+/// @note Clock is read once per DEFRAG_CLOCK_PERIOD elements, so at least that many elements
+/// are checked and budget may be exceeded by time of their moves, other notes of list_defragStep() apply
+template <typename T, typename IndexT>
+size_t list_defragFor(BasicList<T, IndexT> *list, unsigned long long timeBudget,
+                      std::type_identity_t<basic_list_relocation_t<IndexT>> relocation = nullptr,
+                      void *argument = nullptr, int *error = nullptr);
+
+/// Enable or disable order index of list
+/// @param [in/out] list List
+/// @param [in] enable 1 for build order index, 0 for free it
+/// @param [in/out] error Variable for save errors` code
+/// @note With order index list_indexOf() and list_positionOf() take O(log(size)),
+/// insert and remove take O(log(size)) more
+template <typename T, typename IndexT>
+void list_enableOrderIndex(BasicList<T, IndexT> *list, int enable, int *error = nullptr);
 
 /// Get list capacity of data
 /// @param [in] list List
 /// @param [in/out] error Variable for save errors` code
 /// @return Capacity of .data
-size_t list_capacity(const List *list, int *error = nullptr);
+template <typename T, typename IndexT>
+size_t list_capacity(const BasicList<T, IndexT> *list, int *error = nullptr);
 
 /// Resize list
 /// @param [in/out] list List for resize
@@ -215,14 +749,112 @@ size_t list_capacity(const List *list, int *error = nullptr);
 /// @param [in] restoreLinearity Does need restore linearity of list
 /// @param [in/out] error Variable for save errors` code
 /// @note !!!Warning!!! Decrease size of list maight be invalid it
-void list_resize(List *list, size_t newCapacity, int restoreLinearity = 0, int *error = nullptr);
+template <typename T, typename IndexT>
+void list_resize(BasicList<T, IndexT> *list, size_t newCapacity, int restoreLinearity = 0,
+                 int *error = nullptr);
 
 /// Restore linearity of List
 /// @param [in/out] list List for restore
 /// @param [in] newCapacity Size of new alloced memeory where will be copied data
 /// @param [in/out] error Variable for save errors` code
 /// @note !!!Warning!!! After call this function each index_t will be invalid
-void list_restoreLinearity(List *list, size_t newCapacity = 0, int *error = nullptr);
+/// @note List with PARALLEL_RANKING_MIN_SIZE or more elements is ranked on getParallelThreadCount() threads:
+/// every RANKING_RULER_SPACING-th Node starts sublist which is measured and copied by one task
+template <typename T, typename IndexT>
+void list_restoreLinearity(BasicList<T, IndexT> *list, size_t newCapacity = 0, int *error = nullptr);
+
+/// Save list to file which may be mapped by list_mapFromFile()
+/// @param [in] list List
+/// @param [in] fileName Name of file, it is replaced atomically
+/// @param [in/out] error Variable for save errors` code
+/// @note Takes O(capacity), free Nodes above high-water mark aren`t saved
+template <typename T, typename IndexT>
+void list_saveToFile(const BasicList<T, IndexT> *list, const char *fileName, int *error = nullptr);
+
+#define list_mapFromFile(LIST, FILE_NAME, ...)                                  \
+  do_list_mapFromFile(LIST, FILE_NAME, DEBUG_INFO(LIST) __VA_OPT__(,) __VA_ARGS__);
+
+/// Constructor for list from file which was saved by list_saveToFile()
+/// @param [in] list List for initilizate
+/// @param [in] fileName Name of file
+/// @param [in] info Information about call of this function
+/// @param [in/out] error Variable for save errors` code
+/// @note Nodes aren`t copied, list uses private mapping of file in LIST_STORAGE_AOS
+/// until first resize, changes of list aren`t written to file
+/// @note Only header and canaries are checked, hashes of Nodes are checked lazily
+/// by validateList() or list_findBrokenHashBlock()
+/// @note Use for init list list_mapFromFile()
+template <typename T, typename IndexT>
+void do_list_mapFromFile(BasicList<T, IndexT> *list, const char *fileName, DebugInfo info,
+                         int *error = nullptr);
+
+/// Enable write-ahead journal of changes of list
+/// @param [in/out] list List
+/// @param [in] journalName Name of journal file
+/// @param [in] snapshotName Name of checkpoint file
+/// @param [in] policy Rules of writes, syncs and checkpoints
+/// @param [in/out] error Variable for save errors` code
+/// @note Checkpoint is made at once, after it insert, remove, move, resize and
+/// defrag step append one record to journal, other changes make checkpoint
+/// @note Records which aren`t synced yet are lost at crash, list_syncJournal() makes them durable
+template <typename T, typename IndexT>
+void list_enableJournal(BasicList<T, IndexT> *list, const char *journalName, const char *snapshotName,
+                        ListJournalPolicy policy = DEFAULT_JOURNAL_POLICY, int *error = nullptr);
+
+/// Write and sync all records and disable journal, files stay for recovery
+/// @param [in/out] list List
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_disableJournal(BasicList<T, IndexT> *list, int *error = nullptr);
+
+/// Write records which are buffered for group commit and sync journal
+/// @param [in/out] list List with enabled journal
+/// @param [in/out] error Variable for save errors` code
+template <typename T, typename IndexT>
+void list_syncJournal(BasicList<T, IndexT> *list, int *error = nullptr);
+
+/// Save list to checkpoint file and clear journal
+/// @param [in/out] list List with enabled journal
+/// @param [in/out] error Variable for save errors` code
+/// @note Takes O(capacity)
+template <typename T, typename IndexT>
+void list_checkpoint(BasicList<T, IndexT> *list, int *error = nullptr);
+
+#define list_recover(LIST, SNAPSHOT_NAME, JOURNAL_NAME, ...)                         \
+  do_list_recover(LIST, SNAPSHOT_NAME, JOURNAL_NAME, DEBUG_INFO(LIST) __VA_OPT__(,) __VA_ARGS__);
+
+/// Constructor for list from last checkpoint and records of journal after it
+/// @param [in] list List for initilizate
+/// @param [in] snapshotName Name of checkpoint file
+/// @param [in] journalName Name of journal file
+/// @param [in] info Information about call of this function
+/// @param [in/out] error Variable for save errors` code
+/// @note Indexes of elements are the same as before crash, ListCapacityPolicy and
+/// journal aren`t restored and have to be set again
+/// @note Use for init list list_recover()
+template <typename T, typename IndexT>
+void do_list_recover(BasicList<T, IndexT> *list, const char *snapshotName, const char *journalName,
+                     DebugInfo info, int *error = nullptr);
+
+#ifdef NEED_HASH_
+
+/// Set hash function for list and recalculate all hashes
+/// @param [in/out] list List
+/// @param [in] kind Kind of hash function
+/// @param [in/out] error Variable for save errors` code
+/// @note Takes O(capacity)
+template <typename T, typename IndexT>
+void list_setHashKind(BasicList<T, IndexT> *list, HashKind kind, int *error = nullptr);
+
+/// Find block of data which hash isn`t equal to saved in hash tree
+/// @param [in] list List
+/// @param [in] startBlock Index of block from which search starts
+/// @return Index of first broken block not less than startBlock or count of blocks if there isn`t it
+/// @note Block with index i contains Nodes from i*HASH_BLOCK_SIZE to (i + 1)*HASH_BLOCK_SIZE
+template <typename T, typename IndexT>
+size_t list_findBrokenHashBlock(const BasicList<T, IndexT> *list, size_t startBlock = 0);
+
+#endif
 
 #define dumpList(LIST, ERROR, FILE)                       \
   do_dumpList(LIST, ERROR, FILE, __FILE__, __func__, __LINE__, "")
@@ -239,8 +871,9 @@ void list_restoreLinearity(List *list, size_t newCapacity = 0, int *error = null
 /// @param [in] line Number of line  where was call this function
 /// @param [in] message Message(C-like format string) for title
 /// @param [in] ... arguments for message
+template <typename T, typename IndexT>
 void do_dumpList(
-              const List *list,
+              const BasicList<T, IndexT> *list,
               unsigned error,
               FILE *file,
               const char *fileName,
@@ -250,4 +883,6 @@ void do_dumpList(
               ...
               );
 
+#include "listimpl.h"
+
 #endif
@@ -1,6 +1,12 @@
 #ifndef LISTDUMP_H_
 #define LISTDUMP_H_
 
-char *createImage(const List *list);
+#include "list.h"
+
+template <typename T, typename IndexT>
+char *createImage(const BasicList<T, IndexT> *list);
+
+#include "listdumpimpl.h"
+#include "imagegeneratorimpl.h"
 
 #endif
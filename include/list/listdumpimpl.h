@@ -0,0 +1,295 @@
+#ifndef LISTDUMPIMPL_H_
+#define LISTDUMPIMPL_H_
+
+#include "list.h"
+#include "listdump.h"
+#include "elementfunctions.h"
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include "systemlike.h"
+
+/// Line between parts of dump
+const char *const DUMP_SEPARATOR = "==========================================================";
+
+const char *const ERROR_MESSAGE[] =
+  {
+    "Pointer to list is nullptr",
+    "Pointer to list is incorrect",
+    "Pointer to data is nullptr or incorrect when capacity isn`t 0",
+    "Capacity less than size",
+    "Head isn`t correct",
+    "Tail isn`t correct",
+    "Left canary died",
+    "Right canary died",
+    "Left data canary died",
+    "Right data canary died",
+    "Hash of list isn`t correct",
+    "Hash of data isn`t correct",
+    "Invalid free index",
+    "Free sequence is incorrect",
+    "Main sequence is incorrect"
+  };
+
+/// Lock which serializes dumps of lists from different threads
+inline pthread_mutex_t DUMP_MUTEX = PTHREAD_MUTEX_INITIALIZER;
+
+#ifdef DEBUG_BUILD_
+
+template <typename T, typename IndexT>
+static void printDebugInfo(const BasicList<T, IndexT> *list, FILE *file);
+
+#endif
+
+static inline void printCallInfo(
+                                 const char *fileName,
+                                 const char *functionName,
+                                 int line,
+                                 FILE *file
+                                 );
+
+#ifdef NEED_HASH_
+
+template <typename T, typename IndexT>
+static void printHash(const BasicList<T, IndexT> *list, FILE *file);
+
+#endif
+
+static inline void printError(unsigned error, FILE *file);
+
+template <typename T, typename IndexT>
+static void printFields(const BasicList<T, IndexT> *list, FILE *file);
+
+template <typename T, typename IndexT>
+static void printData(const BasicList<T, IndexT> *list, FILE *file);
+
+template <typename T, typename IndexT>
+void do_dumpList(
+              const BasicList<T, IndexT> *list,
+              unsigned error,
+              FILE *file,
+              const char *fileName,
+              const char *functionName,
+              int line,
+              const char *message,
+              ...
+              )
+{
+  if (!file)
+    file = stdout;
+
+  pthread_mutex_lock(&DUMP_MUTEX);
+
+  fprintf(file, "<h2>");
+
+  va_list args = {};
+
+  va_start(args, message);
+
+  vfprintf(file, message, args);
+
+  va_end(args);
+
+  fprintf(file, "</h2>\n");
+
+#ifdef DEBUG_BUILD_
+
+  printDebugInfo(list, file);
+
+#endif
+
+  fprintf(file, "List[%p] ", (const void *)list);
+
+  if (isPointerCorrect(list))
+    {
+      printCallInfo(fileName, functionName, line, file);
+
+#ifdef NEED_HASH_
+
+      printHash(list, file);
+
+#endif
+    }
+
+  printError(error, file);
+
+  if (isPointerCorrect(list))
+    {
+      printFields(list, file);
+
+      printData(list, file);
+    }
+
+  fputc('\n', file);
+
+  pthread_mutex_unlock(&DUMP_MUTEX);
+}
+
+#ifdef DEBUG_BUILD_
+
+template <typename T, typename IndexT>
+static void printDebugInfo(const BasicList<T, IndexT> *list, FILE *file)
+{
+  fprintf(
+          file,
+          "\"%s\" at %s at %s(%d)\n",
+          isPointerCorrect(list->info.name)         ? list->info.name         : "null",
+          isPointerCorrect(list->info.functionName) ? list->info.functionName : "null",
+          isPointerCorrect(list->info.fileName)     ? list->info.fileName     : "null",
+          list->info.line
+          );
+}
+
+#endif
+
+static inline void printCallInfo(
+                                 const char *fileName,
+                                 const char *functionName,
+                                 int line,
+                                 FILE *file
+                                 )
+{
+  fprintf(
+          file,
+          "%s at %s(%d):\n",
+          isPointerCorrect(functionName) ? functionName : "null",
+          isPointerCorrect(fileName)     ? fileName     : "null",
+          line
+          );
+}
+
+#ifdef NEED_HASH_
+
+template <typename T, typename IndexT>
+static void printHash(const BasicList<T, IndexT> *list, FILE *file)
+{
+  fprintf(file, "Hash: %X Data hash: %X\n", list->hash, list->dataHash);
+
+  size_t blockCount = (list->capacity + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+
+  size_t block = list_findBrokenHashBlock(list);
+
+  while (block < blockCount)
+    {
+      size_t end = block + 1;
+
+      while (end < blockCount && list_findBrokenHashBlock(list, end) == end)
+        ++end;
+
+      fprintf(file, "<font color = red />Broken data hash of Nodes [%zu, %zu)<font color = black />\n",
+              block*HASH_BLOCK_SIZE, end*HASH_BLOCK_SIZE);
+
+      block = list_findBrokenHashBlock(list, end);
+    }
+}
+
+#endif
+
+static inline void printError(unsigned error, FILE *file)
+{
+  if (!error)
+    {
+      fprintf(file, "No error\n");
+
+      return;
+    }
+
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
+
+  fprintf(file, "<font color = red />Erors:\n");
+
+  for (int i = 0; i < ERROR_COUNT; ++i)
+    if ((error >> i) & 0x01)
+      fprintf(file, "%s,\n", ERROR_MESSAGE[i]);
+
+  fprintf(file, "<font color = black />%s\n", DUMP_SEPARATOR);
+}
+
+template <typename T, typename IndexT>
+static void printFields(const BasicList<T, IndexT> *list, FILE *file)
+{
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
+
+  fprintf(file, "canary_t leftCanary = %X;\n", list->leftCanary);
+
+  if (list->storage == LIST_STORAGE_SOA)
+    {
+      fprintf(file, "element_t *elems = %p;\n", (void *)list->elems);
+
+      fprintf(file, "index_t *nexts = %p;\n", (void *)list->nexts);
+
+      fprintf(file, "index_t *prevs = %p;\n", (void *)list->prevs);
+    }
+  else if (list->storage == LIST_STORAGE_CHUNKED)
+    fprintf(file, "Node **chunks = %p;\n", (void *)list->chunks);
+  else
+    fprintf(file, "Node *data = %p;\n", (void *)list->data);
+
+  if (list->file)
+    fprintf(file, "void *file = %p; size_t fileSize = %zu;\n", list->file, list->fileSize);
+
+  fprintf(file, "size_t capacity = %zu;\n", list->capacity);
+
+  fprintf(file, "size_t size = %zu;\n", list->size);
+
+  fprintf(file, "size_t untouched = %zu;\n", list->untouched);
+
+  fprintf(file, "size_t reserved = %zu;\n", list->reserved);
+
+  fprintf(file, "size_t head = %lld;\n", (long long)list_head(list));
+
+  fprintf(file, "size_t tail = %lld;\n", (long long)list_tail(list));
+
+  fprintf(file, "size_t free = %lld;\n", (long long)list->free);
+
+  fprintf(file, "int validationLevel = %d;\n", list->validationLevel);
+
+  fprintf(file, "int storage = %d;\n", list->storage);
+
+  fprintf(file, "int isLinear = %d;\n", list->isLinear);
+
+  fprintf(file, "size_t defragPosition = %zu;\n", list->defragPosition);
+
+  fprintf(file, "ListCapacityPolicy policy = {%g, %g, %zu};\n",
+          list->policy.growthFactor, list->policy.shrinkLoad, list->policy.minCapacity);
+
+  fprintf(file, "OrderIndex *orderIndex = %p;\n", (void *)list->orderIndex);
+
+  fprintf(file, "ListJournal *journal = %p;\n", (void *)list->journal);
+
+  fprintf(file, "canary_t rightCanary = %X;\n", list->rightCanary);
+
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
+}
+
+template <typename T, typename IndexT>
+static void printData(const BasicList<T, IndexT> *list, FILE *file)
+{
+  const char *image = createImage(list);
+
+  fprintf(file, "<hr>\n");
+
+  fprintf(file, "<!%s>", DUMP_SEPARATOR);
+
+  fprintf(file, "<image src=../%s />", image);
+
+  fprintf(file, "<hr>\n");
+
+  fprintf(file, "<!%s>", DUMP_SEPARATOR);
+}
+
+/// Dump is cold, so dump of List is compiled only in listinstances.cpp
+extern template
+void do_dumpList<element_t, index_t>(
+                                     const List *list,
+                                     unsigned error,
+                                     FILE *file,
+                                     const char *fileName,
+                                     const char *functionName,
+                                     int line,
+                                     const char *message,
+                                     ...
+                                     );
+
+#endif
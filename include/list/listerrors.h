@@ -0,0 +1,53 @@
+#ifndef LISTERRORS_H_
+#define LISTERRORS_H_
+
+#include "list.h"
+
+#include "logging.h"
+#include "systemlike.h"
+
+#endif
+
+/// Macros are out of guard because implementation headers of list undefine them at their ends,
+/// so each file which includes this header gets them again
+
+/// Set -1 to variable error of calling function and return from it with value
+#define ERROR(...)                                    \
+  do                                                  \
+    {                                                 \
+      if (isPointerCorrect(error))                    \
+        *error = -1;                                  \
+                                                      \
+      return __VA_ARGS__;                             \
+    } while (0)
+
+/// Save nonzero ERR_ to ERROR_ and return from calling function with value
+#define CHECK_ERROR(ERR_, ERROR_, ...)             \
+  do                                               \
+    {                                              \
+      if (ERR_ && isPointerCorrect(ERROR_))        \
+        {                                          \
+          *ERROR_ = ERR_;                          \
+                                                   \
+          ERROR(__VA_ARGS__);                      \
+        }                                          \
+    } while (0)
+
+/// Validate list, dump it and save errors` code to ERROR and return from calling function with value
+/// if it is broken
+#define CHECK_VALID(LIST, ERROR, ...)               \
+  do                                                \
+    {                                               \
+      unsigned errorCode = validateList(LIST);      \
+                                                    \
+      if (errorCode)                                \
+        {                                           \
+          dumpList(LIST, errorCode, lockLogFile()); \
+          unlockLogFile();                          \
+                                                    \
+          if (isPointerCorrect(ERROR))              \
+            *ERROR = (int)errorCode;                \
+                                                    \
+          return __VA_ARGS__;                       \
+        }                                           \
+    } while (0)
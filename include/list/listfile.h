@@ -0,0 +1,66 @@
+#ifndef LISTFILE_H_
+#define LISTFILE_H_
+
+#include "list.h"
+
+/// Magic number at start of List file, "LIST" in file
+const unsigned LIST_FILE_MAGIC = 0x5453494C;
+
+/// Version of format of List file, it is changed with layout of file
+const unsigned LIST_FILE_VERSION = 1;
+
+/// Header of List file
+/// @note It is followed by zero padding, LEFT_CANARY, ::capacity Nodes, RIGHT_CANARY
+/// and ::blockCount hashes of blocks of HASH_BLOCK_SIZE Nodes, padding aligns Nodes by alignof(Node)
+template <typename IndexT>
+struct BasicListFileHeader {
+  canary_t leftCanary;   /// <- LEFT_CANARY
+  unsigned magic;        /// <- LIST_FILE_MAGIC
+  unsigned version;      /// <- LIST_FILE_VERSION
+  unsigned nodeSize;     /// <- Size of Node of program which wrote file
+  int hashKind;          /// <- HashKind of hashes of Nodes and this header
+  int validationLevel;   /// <- List::validationLevel
+  int isLinear;          /// <- List::isLinear
+  IndexT free;           /// <- List::free
+  size_t capacity;       /// <- Count of Nodes in file, all of them are touched
+  size_t size;           /// <- List::size
+  size_t defragPosition; /// <- List::defragPosition
+  size_t blockCount;     /// <- Count of hashes of blocks after Nodes
+  hash_t dataHash;       /// <- List::dataHash
+  hash_t hash;           /// <- Hash of this header from ::leftCanary to ::hash
+  canary_t rightCanary;  /// <- RIGHT_CANARY
+  unsigned reserved;     /// <- Zero
+};
+
+typedef BasicListFileHeader<index_t> ListFileHeader;
+
+/// Write list to file in format of ListFileHeader
+/// @param [in] list List
+/// @param [in] fileName Name of file
+/// @param [out] headerHash ListFileHeader::hash of written file or nullptr
+/// @return 0 if file was written else -1
+/// @note Only Nodes under List::untouched are written, file is replaced atomically by rename
+/// and its directory is flushed after it
+template <typename T, typename IndexT>
+int writeListFile(const BasicList<T, IndexT> *list, const char *fileName, hash_t *headerHash = nullptr);
+
+/// Read ListFileHeader::hash of file without check of file
+/// @param [in] fileName Name of file
+/// @param [out] headerHash Hash of header
+/// @return 0 if hash was read else -1
+template <typename IndexT>
+int readListFileHash(const char *fileName, hash_t *headerHash);
+
+/// Map file and point List::data of list to its Nodes
+/// @param [out] list List which gets fields from file, others aren`t changed
+/// @param [in] fileName Name of file
+/// @param [out] blockHashes Pointer to hashes of blocks in mapped file
+/// @return 0 if file was mapped else -1
+/// @note Checks header, its hash, its indexes, canaries and links of sentinel and first free Node in O(1),
+/// hashes of Nodes aren`t checked
+template <typename T, typename IndexT>
+int mapListFile(BasicList<T, IndexT> *list, const char *fileName, const hash_t **blockHashes);
+
+#include "listfileimpl.h"
+
+#endif
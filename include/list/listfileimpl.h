@@ -0,0 +1,334 @@
+#ifndef LISTFILEIMPL_H_
+#define LISTFILEIMPL_H_
+
+#include "list.h"
+#include "listfile.h"
+#include "liststorage.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "systemlike.h"
+
+/// Max length of name of temporary file which is renamed to List file
+const size_t TEMP_FILE_NAME_SIZE = 4096;
+
+/// Hash of header from ListFileHeader::leftCanary to ListFileHeader::hash
+template <typename IndexT>
+static hash_t getHeaderHash(const BasicListFileHeader<IndexT> *header);
+
+/// Offset of Nodes from start of List file, left canary is right before them
+template <typename T, typename IndexT>
+static size_t getNodesOffset();
+
+/// Size of List file with header
+template <typename T, typename IndexT>
+static size_t getListFileSize(const BasicListFileHeader<IndexT> *header);
+
+/// Check fields of header which are independent of other file
+template <typename T, typename IndexT>
+static int isHeaderCorrect(const BasicListFileHeader<IndexT> *header, size_t fileSize);
+
+/// Check that links of sentinel Node and first free Node are indexes of Nodes of file
+template <typename T, typename IndexT>
+static int isEntryCorrect(const BasicNode<T, IndexT> *nodes, const BasicListFileHeader<IndexT> *header);
+
+/// Write padding after header and Nodes from 0 to List::untouched with canaries around them
+template <typename T, typename IndexT>
+static int writeNodes(const BasicList<T, IndexT> *list, FILE *file);
+
+/// Write hashes of blocks of Nodes
+template <typename T, typename IndexT>
+static int writeBlockHashes(const BasicList<T, IndexT> *list, size_t blockCount, FILE *file);
+
+template <typename T, typename IndexT>
+int writeListFile(const BasicList<T, IndexT> *list, const char *fileName, hash_t *headerHash)
+{
+  char tempName[TEMP_FILE_NAME_SIZE] = "";
+
+  if (snprintf(tempName, TEMP_FILE_NAME_SIZE, "%s.tmp", fileName) >= (int)TEMP_FILE_NAME_SIZE)
+    return -1;
+
+  BasicListFileHeader<IndexT> header = {};
+
+  memset(&header, 0, sizeof(header));
+
+  header.leftCanary      = LEFT_CANARY;
+  header.magic           = LIST_FILE_MAGIC;
+  header.version         = LIST_FILE_VERSION;
+  header.nodeSize        = sizeof(BasicNode<T, IndexT>);
+  header.validationLevel = list->validationLevel;
+  header.isLinear        = list->isLinear;
+  header.free            = list->free;
+  header.capacity        = list->untouched;
+  header.size            = list->size;
+  header.defragPosition  = list->defragPosition;
+  header.blockCount      = (list->untouched + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+  header.rightCanary     = RIGHT_CANARY;
+
+#ifdef NEED_HASH_
+
+  header.hashKind = list->hashKind;
+  header.dataHash = list->dataHash;
+
+#else
+
+  header.hashKind = DEFAULT_HASH_KIND_;
+
+#endif
+
+  header.hash = getHeaderHash(&header);
+
+  FILE *file = fopen(tempName, "wb");
+
+  if (!file)
+    return -1;
+
+  int error = fwrite(&header, sizeof(header), 1, file) != 1 ||
+              writeNodes(list, file)                          ||
+              writeBlockHashes(list, header.blockCount, file) ||
+              fflush(file)                                    ||
+              fsync(fileno(file));
+
+  if (fclose(file))
+    error = 1;
+
+  if (error || rename(tempName, fileName))
+    {
+      remove(tempName);
+
+      return -1;
+    }
+
+  if (syncDirectory(fileName))
+    return -1;
+
+  if (headerHash)
+    *headerHash = header.hash;
+
+  return 0;
+}
+
+template <typename IndexT>
+int readListFileHash(const char *fileName, hash_t *headerHash)
+{
+  FILE *file = fopen(fileName, "rb");
+
+  if (!file)
+    return -1;
+
+  BasicListFileHeader<IndexT> header = {};
+
+  int error = fread(&header, sizeof(header), 1, file) != 1;
+
+  fclose(file);
+
+  if (error)
+    return -1;
+
+  *headerHash = header.hash;
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+int mapListFile(BasicList<T, IndexT> *list, const char *fileName, const hash_t **blockHashes)
+{
+  size_t fileSize = 0;
+
+  char *file = (char *)mapFile(fileName, &fileSize);
+
+  if (!file)
+    return -1;
+
+  const BasicListFileHeader<IndexT> *header = (const BasicListFileHeader<IndexT> *)file;
+
+  if (!isHeaderCorrect<T>(header, fileSize))
+    {
+      mapFree(file, fileSize);
+
+      return -1;
+    }
+
+  char *nodes = file + getNodesOffset<T, IndexT>();
+
+  canary_t leftCanary  = 0;
+  canary_t rightCanary = 0;
+
+  memcpy(&leftCanary,  nodes - sizeof(canary_t), sizeof(canary_t));
+  memcpy(&rightCanary, nodes + header->capacity*sizeof(BasicNode<T, IndexT>), sizeof(canary_t));
+
+  if (leftCanary != LEFT_CANARY || rightCanary != RIGHT_CANARY ||
+      !isEntryCorrect((const BasicNode<T, IndexT> *)nodes, header))
+    {
+      mapFree(file, fileSize);
+
+      return -1;
+    }
+
+  list->data   = (BasicNode<T, IndexT> *)nodes;
+  list->elems  = nullptr;
+  list->nexts  = nullptr;
+  list->prevs  = nullptr;
+  list->chunks = nullptr;
+
+  list->file     = file;
+  list->fileSize = fileSize;
+
+  list->capacity  = header->capacity;
+  list->size      = header->size;
+  list->untouched = header->capacity;
+
+  list->defragPosition = header->defragPosition;
+  list->free           = header->free;
+
+  list->validationLevel = header->validationLevel;
+  list->storage         = LIST_STORAGE_AOS;
+  list->isLinear        = header->isLinear;
+
+#ifdef NEED_HASH_
+
+  list->hashKind = header->hashKind;
+  list->dataHash = header->dataHash;
+
+#endif
+
+  *blockHashes = (const hash_t *)(nodes + header->capacity*sizeof(BasicNode<T, IndexT>) + sizeof(canary_t));
+
+  return 0;
+}
+
+template <typename IndexT>
+static hash_t getHeaderHash(const BasicListFileHeader<IndexT> *header)
+{
+  return getHashFunction((HashKind)header->hashKind)(header, &header->hash);
+}
+
+template <typename T, typename IndexT>
+static size_t getNodesOffset()
+{
+  const size_t align = alignof(BasicNode<T, IndexT>);
+
+  return (sizeof(BasicListFileHeader<IndexT>) + sizeof(canary_t) + align - 1) / align * align;
+}
+
+template <typename T, typename IndexT>
+static size_t getListFileSize(const BasicListFileHeader<IndexT> *header)
+{
+  return getNodesOffset<T, IndexT>() + sizeof(canary_t) +
+         header->capacity*sizeof(BasicNode<T, IndexT>) + header->blockCount*sizeof(hash_t);
+}
+
+template <typename T, typename IndexT>
+static int isHeaderCorrect(const BasicListFileHeader<IndexT> *header, size_t fileSize)
+{
+  if (fileSize < getNodesOffset<T, IndexT>())
+    return 0;
+
+  if (header->leftCanary != LEFT_CANARY || header->rightCanary != RIGHT_CANARY)
+    return 0;
+
+  if (header->magic != LIST_FILE_MAGIC || header->version != LIST_FILE_VERSION ||
+      header->nodeSize != sizeof(BasicNode<T, IndexT>))
+    return 0;
+
+  if (header->hashKind < 0 || HASH_KIND_COUNT <= header->hashKind)
+    return 0;
+
+  if (getHeaderHash(header) != header->hash)
+    return 0;
+
+  if (!header->capacity || header->size >= header->capacity ||
+      header->blockCount != (header->capacity + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE)
+    return 0;
+
+  if (header->free < 0 || header->capacity <= (size_t)header->free ||
+      header->defragPosition > header->size)
+    return 0;
+
+  if (header->validationLevel < LIST_VALIDATE_NONE || LIST_VALIDATE_DEEP < header->validationLevel ||
+      (header->isLinear != 0 && header->isLinear != 1))
+    return 0;
+
+  return getListFileSize<T>(header) == fileSize;
+}
+
+template <typename T, typename IndexT>
+static int isEntryCorrect(const BasicNode<T, IndexT> *nodes, const BasicListFileHeader<IndexT> *header)
+{
+  const BasicNode<T, IndexT> *sentinel = &nodes[0];
+
+  if (sentinel->next < 0 || header->capacity <= (size_t)sentinel->next ||
+      sentinel->prev < 0 || header->capacity <= (size_t)sentinel->prev ||
+      (sentinel->next == nullindex) != (header->size == 0))
+    return 0;
+
+  if (header->free == nullindex)
+    return 1;
+
+  const BasicNode<T, IndexT> *first = &nodes[header->free];
+
+  return first->prev < 0 && 0 <= first->next && (size_t)first->next < header->capacity;
+}
+
+template <typename T, typename IndexT>
+static int writeNodes(const BasicList<T, IndexT> *list, FILE *file)
+{
+  canary_t leftCanary  = LEFT_CANARY;
+  canary_t rightCanary = RIGHT_CANARY;
+
+  size_t padding = getNodesOffset<T, IndexT>() - sizeof(BasicListFileHeader<IndexT>) - sizeof(canary_t);
+
+  for (size_t i = 0; i < padding; ++i)
+    if (fputc(0, file) == EOF)
+      return -1;
+
+  if (fwrite(&leftCanary, sizeof(canary_t), 1, file) != 1)
+    return -1;
+
+  if (list->storage == LIST_STORAGE_AOS)
+    {
+      if (fwrite(list->data, sizeof(BasicNode<T, IndexT>), list->untouched, file) != list->untouched)
+        return -1;
+    }
+  else
+    for (size_t i = 0; i < list->untouched; ++i)
+      {
+        BasicNode<T, IndexT> node = readNode(list, (IndexT)i);
+
+        if (fwrite(&node, sizeof(BasicNode<T, IndexT>), 1, file) != 1)
+          return -1;
+      }
+
+  if (fwrite(&rightCanary, sizeof(canary_t), 1, file) != 1)
+    return -1;
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int writeBlockHashes(const BasicList<T, IndexT> *list, size_t blockCount, FILE *file)
+{
+#ifdef NEED_HASH_
+
+  if (list->hashTree)
+    return fwrite(list->hashTree + list->hashTreeLeaves, sizeof(hash_t), blockCount, file) !=
+           blockCount;
+
+#else
+
+  (void)list;
+
+#endif
+
+  hash_t zero = nullhash;
+
+  for (size_t i = 0; i < blockCount; ++i)
+    if (fwrite(&zero, sizeof(hash_t), 1, file) != 1)
+      return -1;
+
+  return 0;
+}
+
+#endif
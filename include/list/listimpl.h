@@ -0,0 +1,2907 @@
+#ifndef LISTIMPL_H_
+#define LISTIMPL_H_
+
+#include "list.h"
+#include "listerrors.h"
+#include "liststorage.h"
+#include "listsort.h"
+#include "listorder.h"
+#include "listfile.h"
+#include "listjournal.h"
+#include "listdump.h"
+
+#include "logging.h"
+#include "systemlike.h"
+#include "parallel.h"
+#include "asserts.h"
+
+#include "elementfunctions.h"
+
+#include <string.h>
+#include <stdint.h>
+
+#ifdef NEED_HASH_
+
+#define UPDATE_HASH(LIST)                                                \
+  do                                                                     \
+    {                                                                    \
+      LIST->hash = getStructHash(LIST);                                  \
+    } while (0)
+
+#else
+
+#define UPDATE_HASH(LIST)                                                \
+  do                                                                     \
+    {                                                                    \
+    } while (0)
+
+#endif
+
+const index_t POISON_PREV = -1;
+
+/// Count of bits in one word of bitmap of visited Nodes
+const size_t VISITED_WORD_BITS = 64;
+
+/// Arguments of tasks of deep validation
+template <typename T, typename IndexT>
+struct ValidationContext {
+  const BasicList<T, IndexT> *list;     /// <- List
+  const unsigned long long   *visited;  /// <- Bitmap of Nodes of main and free sequences
+  size_t                      reserved; /// <- Count of found reserved Nodes
+  int                         isLeaked; /// <- Node which isn`t element, free or reserved is found
+};
+
+/// Sublist of parallel ranking from ruler to next ruler
+struct RankingRuler {
+  int    isRuler; /// <- Node of slot is element which starts sublist
+  size_t length;  /// <- Count of Nodes in sublist
+  size_t offset;  /// <- Position of ruler in list
+  size_t next;    /// <- Slot of next ruler or RankingContext::slotCount for last sublist
+};
+
+/// Arguments of tasks of parallel ranking
+/// @note Slot i is Node i*RANKING_RULER_SPACING, last slot is head if its index isn`t multiple of spacing
+template <typename T, typename IndexT>
+struct RankingContext {
+  const BasicList<T, IndexT> *list;      /// <- List which is ranked
+  BasicList<T, IndexT>       *temp;      /// <- List with new storage for linear Nodes
+  RankingRuler               *rulers;    /// <- Sublists
+  size_t                      slotCount; /// <- Count of slots
+};
+
+/// Arguments of tasks of list_parallelForEach()
+template <typename T, typename IndexT>
+struct ParallelListContext {
+  const BasicList<T, IndexT>          *list;     /// <- List
+  const IndexT                        *starts;   /// <- First Node of each chunk, nullptr for linear list
+  basic_list_visitor_t<T, IndexT>      visitor;  /// <- Function which gets elements
+  void                                *argument; /// <- Argument of function
+};
+
+/// Arguments of tasks of list_parallelTransform()
+template <typename T, typename IndexT>
+struct ParallelTransformContext {
+  BasicList<T, IndexT>                *list;      /// <- List
+  const IndexT                        *starts;    /// <- First Node of each chunk, nullptr for linear list
+  basic_list_transform_t<T, IndexT>    transform; /// <- Function which changes elements
+  void                                *argument;  /// <- Argument of function
+};
+
+template <typename T, typename IndexT>
+static void createDataArray(BasicList<T, IndexT> *list, size_t capacity, int *error = nullptr);
+
+/// Walk main and free sequences and check that other Nodes below List::untouched are reserved
+template <typename T, typename IndexT>
+static unsigned validateSequences(const BasicList<T, IndexT> *list);
+
+/// Walk main sequence from head to tail and check links
+/// @param [in/out] visited Bitmap of visited Nodes or nullptr
+template <typename T, typename IndexT>
+static unsigned validateMainSequence(const BasicList<T, IndexT> *list, unsigned long long *visited);
+
+/// Walk free sequence and check encoded links to previous free Nodes
+/// @param [in/out] visited Bitmap of visited Nodes
+template <typename T, typename IndexT>
+static unsigned validateFreeSequence(const BasicList<T, IndexT> *list, unsigned long long *visited);
+
+/// Mark Node in bitmap
+/// @return 1 if Node was marked before else 0
+template <typename IndexT>
+static int markVisited(unsigned long long *visited, IndexT index);
+
+/// Task which checks that not visited Nodes of one chunk are reserved
+template <typename T, typename IndexT>
+static void scanCells(void *context, size_t taskIndex);
+
+#ifdef NEED_HASH_
+
+/// Hash of List from ::leftCanary to ::hash
+template <typename T, typename IndexT>
+static hash_t getStructHash(const BasicList<T, IndexT> *list);
+
+/// Hash of one Node which is summand of List::dataHash
+template <typename T, typename IndexT>
+static hash_t getNodeHash(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Recalculation of sum of Nodes` hashes in block of data
+template <typename T, typename IndexT>
+static hash_t getBlockHash(const BasicList<T, IndexT> *list, size_t block);
+
+/// Count of hash blocks which cover data with capacity
+static inline size_t getHashBlockCount(size_t capacity);
+
+/// Alloc hash tree for List::capacity and fill it from data
+template <typename T, typename IndexT>
+static int buildHashTree(BasicList<T, IndexT> *list);
+
+/// Realloc hash tree for newCapacity with saving hashes of blocks
+template <typename T, typename IndexT>
+static int resizeHashTree(BasicList<T, IndexT> *list, size_t newCapacity);
+
+/// Recount sums of hash tree above first count leaves, other leaves must be zero
+static inline void sumHashTree(hash_t *tree, size_t leaves, size_t count);
+
+/// Add delta to List::dataHash and hashes of tree from leaf with index to root
+template <typename T, typename IndexT>
+static void changeDataHash(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index, hash_t delta);
+
+/// Check sums in hash tree and hash of each block
+template <typename T, typename IndexT>
+static int isHashTreeCorrect(const BasicList<T, IndexT> *list);
+
+#endif
+
+/// Write Node to data with updating List::dataHash
+template <typename T, typename IndexT>
+static void setNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<BasicNode<T, IndexT>> node);
+
+/// Write Node::next to data with updating List::dataHash
+template <typename T, typename IndexT>
+static void setNext(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<IndexT> next);
+
+/// Write Node::prev to data with updating List::dataHash
+template <typename T, typename IndexT>
+static void setPrev(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<IndexT> prev);
+
+/// Check that index is index of Node from main sequence or nullindex
+template <typename T, typename IndexT>
+static int isElementOrNull(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Check that Node is in free sequence
+template <typename T, typename IndexT>
+static int isFreeCell(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Node::prev of free cell which follows cell with index in free sequence
+/// @note Free cell keeps previous free cell as POISON_PREV - index, so first one has POISON_PREV
+template <typename IndexT>
+static IndexT getFreePrev(IndexT index);
+
+/// Check that Node is taken by list_reserveSlots(), such Node is poisoned and its next is itself
+template <typename T, typename IndexT>
+static int isReservedCell(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Write free Node out of free sequence to never used Node with updating List::dataHash
+template <typename T, typename IndexT>
+static void touchCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Index of Node which takeFreeCell() returns or nullindex if there isn`t free Node
+template <typename T, typename IndexT>
+static IndexT peekFreeCell(const BasicList<T, IndexT> *list);
+
+/// Change capacity of list with hashes, Nodes above capacity are lost
+/// @note New Nodes stay untouched, so growth doesn`t write them
+/// @note On error list isn`t changed, hash tree and order index which failed to shrink stay larger
+template <typename T, typename IndexT>
+static int resizeStorage(BasicList<T, IndexT> *list, size_t newCapacity);
+
+/// Resize list by ListCapacityPolicy if it hasn`t count free cells
+/// @note LIST_STORAGE_CHUNKED grows only by chunks which are needed
+template <typename T, typename IndexT>
+static int reserveCells(BasicList<T, IndexT> *list, size_t count);
+
+/// Shrink list by ListCapacityPolicy if its load is low
+template <typename T, typename IndexT>
+static int shrinkIfNeeded(BasicList<T, IndexT> *list);
+
+/// Decrease capacity, elements from Nodes above it are moved to free Nodes below it
+template <typename T, typename IndexT>
+static int shrinkStorage(BasicList<T, IndexT> *list, size_t newCapacity,
+                         std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument);
+
+/// Clear List::isLinear if Node with index inserted after anchor breaks linearity
+/// @param [in] size Count of elements before insert of Node
+template <typename T, typename IndexT>
+static void updateLinearity(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                            std::type_identity_t<IndexT> index, size_t size);
+
+/// Decrease List::defragPosition to count if it is bigger
+template <typename T, typename IndexT>
+static void updateDefragPosition(BasicList<T, IndexT> *list, size_t count);
+
+/// Move element from Node with index from to cell with index to
+/// @note Cell to must be unlinked from free sequence and cell from must be freed by caller
+template <typename T, typename IndexT>
+static void moveNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> from,
+                     std::type_identity_t<IndexT> to);
+
+/// Position of Node which follows anchor in OrderIndex of list
+template <typename T, typename IndexT>
+static size_t getPositionAfter(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor);
+
+/// Position of element of list which is linear or has order index
+template <typename T, typename IndexT>
+static size_t getKnownPosition(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Check that last isn`t before first and anchor isn`t in range from first to last
+/// @note It takes O(log(size)) with order index, O(1) for linear list, else range is walked
+template <typename T, typename IndexT>
+static int isRangeMovable(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                          std::type_identity_t<IndexT> last, std::type_identity_t<IndexT> anchor);
+
+/// Take first cell from free sequence
+/// @note Cell must be overwritten by caller
+template <typename T, typename IndexT>
+static IndexT takeFreeCell(BasicList<T, IndexT> *list);
+
+/// Poison cell and put it to free sequence
+template <typename T, typename IndexT>
+static void freeCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Take any cell from free sequence
+/// @note Cell must be overwritten by caller
+template <typename T, typename IndexT>
+static void unlinkFreeCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Write element to unlinked Node and link it after anchor
+template <typename T, typename IndexT>
+static void linkCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                     std::type_identity_t<IndexT> index, std::type_identity_t<T> element);
+
+/// Unlink Nodes from first to last from main sequence
+template <typename T, typename IndexT>
+static void unlinkRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                        std::type_identity_t<IndexT> last);
+
+/// Link unlinked Nodes from first to last after anchor
+template <typename T, typename IndexT>
+static void linkRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                      std::type_identity_t<IndexT> first, std::type_identity_t<IndexT> last);
+
+/// Move elements to Nodes from 1 in order of main sequence by swaps of Nodes and mark all other Nodes untouched
+/// @note Doesn`t update hashes
+template <typename T, typename IndexT>
+static void linearizeNodes(BasicList<T, IndexT> *list);
+
+/// Exchange Node of element from and Node target and relink their neighbours, target may be not element
+/// @note Doesn`t update hashes
+template <typename T, typename IndexT>
+static void swapNodes(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> from,
+                      std::type_identity_t<IndexT> target);
+
+/// Index of Node after exchange of Nodes first and second
+template <typename IndexT>
+static IndexT getSwappedIndex(IndexT index, IndexT first, IndexT second);
+
+/// Append record to journal if it is enabled, make checkpoint if journal is large
+template <typename T, typename IndexT>
+static int writeJournal(BasicList<T, IndexT> *list,
+                        std::type_identity_t<BasicListJournalRecord<IndexT>> record,
+                        const std::type_identity_t<T> *elements = nullptr, size_t count = 0);
+
+/// Save list to checkpoint file and clear journal if it is enabled
+template <typename T, typename IndexT>
+static int checkpointJournal(BasicList<T, IndexT> *list);
+
+/// Write Nodes of list in order of main sequence to Nodes from 0 of storage of temp
+/// @note List with PARALLEL_RANKING_MIN_SIZE or more elements is ranked on all CPU cores
+template <typename T, typename IndexT>
+static void writeRankedNodes(const BasicList<T, IndexT> *list, BasicList<T, IndexT> *temp);
+
+/// Parallel list ranking by sparse ruling set
+/// @return 0 if Nodes were written else -1
+template <typename T, typename IndexT>
+static int writeRankedNodesParallel(const BasicList<T, IndexT> *list, BasicList<T, IndexT> *temp);
+
+/// Index of Node of ruler in slot
+template <typename T, typename IndexT>
+static IndexT getRulerIndex(const RankingContext<T, IndexT> *context, size_t slot);
+
+/// Task which walks sublist of one ruler and counts its Nodes
+template <typename T, typename IndexT>
+static void measureSublist(void *context, size_t taskIndex);
+
+/// Task which writes Nodes of sublist of one ruler to their positions
+template <typename T, typename IndexT>
+static void scatterSublist(void *context, size_t taskIndex);
+
+/// Walk from head and get first Node of each chunk of PARALLEL_CHUNK_SIZE elements
+/// @return Array of chunkCount indexes or nullptr if was error
+template <typename T, typename IndexT>
+static IndexT *partitionList(const BasicList<T, IndexT> *list, size_t chunkCount);
+
+/// Count of chunks and their first Nodes for tasks of list_parallelForEach() and list_parallelTransform()
+template <typename T, typename IndexT>
+static int prepareChunks(const BasicList<T, IndexT> *list, size_t *chunkCount,
+                         std::type_identity_t<IndexT> **starts);
+
+/// Task which calls visitor for one chunk
+template <typename T, typename IndexT>
+static void visitChunk(void *context, size_t taskIndex);
+
+/// Task which calls transform for one chunk and adds changes of hashes to leaves of hash tree
+template <typename T, typename IndexT>
+static void transformChunk(void *context, size_t taskIndex);
+
+/// Move at most budget elements to their Nodes in linear order until deadline
+/// @param [in] deadline Value of getMonotonicTime() after which moves stop, 0 for no deadline
+/// @note Clock is read once per DEFRAG_CLOCK_PERIOD checked elements
+template <typename T, typename IndexT>
+static size_t defragList(BasicList<T, IndexT> *list, size_t budget, unsigned long long deadline,
+                         std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument,
+                         int *error);
+
+/// Apply record of journal to list which is argument
+template <typename T, typename IndexT>
+static int replayJournalRecord(void *argument, const BasicListJournalRecord<IndexT> *record,
+                               const T *elements);
+
+template <typename T, typename IndexT>
+unsigned validateList(const BasicList<T, IndexT> *list)
+{
+  if (!list)
+    return LIST_NULL_POINTER;
+
+  if (!isPointerCorrect(list))
+    return LIST_INCORRECT_POINTER;
+
+  return validateList(list, (ListValidationLevel)list->validationLevel);
+}
+
+template <typename T, typename IndexT>
+unsigned validateList(const BasicList<T, IndexT> *list, ListValidationLevel level)
+{
+  if (!list)
+    return LIST_NULL_POINTER;
+
+  if (!isPointerCorrect(list))
+    return LIST_INCORRECT_POINTER;
+
+  if (level > MAX_VALIDATION_LEVEL_)
+    level = MAX_VALIDATION_LEVEL_;
+
+  if (level < LIST_VALIDATE_FAST)
+    return 0;
+
+  unsigned error = 0;
+
+  if (!hasStorage(list) && list->capacity)
+    return error | LIST_NULL_DATA;
+
+  if (list->size + list->reserved >= list->capacity)
+    error |= LIST_CAPASITY_LESS_THEN_SIZE;
+
+  if (list_head(list) == 0 && list->size)
+    error |= LIST_NOT_HEAD;
+
+  if (list->untouched > list->capacity)
+    error |= LIST_NOT_FREE;
+
+  if (!list->free && list->untouched == list->capacity &&
+      list->size + list->reserved < list->capacity - 1)
+    error |= LIST_NOT_FREE;
+
+#ifdef NEED_CANARY_
+
+  if (list->leftCanary != LEFT_CANARY)
+    error |= LIST_LEFT_CANARY_DIED;
+
+  if (list->rightCanary != RIGHT_CANARY)
+    error |= LIST_RIGHT_CANARY_DIED;
+
+  error |= validateStorage(list, level);
+
+#endif
+
+#ifdef NEED_HASH_
+
+  if (getStructHash(list) != list->hash)
+    error |= LIST_BROKEN_HASH;
+
+  if (isPointerCorrect(list->hashTree) && list->hashTree[1] != list->dataHash)
+    error |= LIST_BROKEN_DATA_HASH;
+
+  if (level >= LIST_VALIDATE_HASH && hasStorage(list))
+    if (!isHashTreeCorrect(list))
+      error |= LIST_BROKEN_DATA_HASH;
+
+#endif
+
+  if (level >= LIST_VALIDATE_DEEP && !error)
+    error |= validateSequences(list);
+
+  return error;
+}
+
+template <typename T, typename IndexT>
+void list_setValidationLevel(BasicList<T, IndexT> *list, ListValidationLevel level, int *error)
+{
+  CHECK_VALID(list, error);
+
+  list->validationLevel = level;
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+static unsigned validateSequences(const BasicList<T, IndexT> *list)
+{
+  if (!hasStorage(list) || !list->untouched)
+    return validateMainSequence(list, nullptr);
+
+  size_t wordCount = (list->untouched + VISITED_WORD_BITS - 1) / VISITED_WORD_BITS;
+
+  unsigned long long *visited = (unsigned long long *)calloc(wordCount, sizeof(unsigned long long));
+
+  if (!visited)
+    return validateMainSequence(list, nullptr);
+
+  unsigned error = validateMainSequence(list, visited);
+
+  if (!error)
+    error = validateFreeSequence(list, visited);
+
+  if (!error)
+    {
+      ValidationContext<T, IndexT> context = {
+        .list     = list,
+        .visited  = visited,
+        .reserved = 0,
+        .isLeaked = 0
+      };
+
+      size_t taskCount = (list->untouched + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+
+      int isScanned = !runParallel(scanCells<T, IndexT>, &context, taskCount,
+                                   (list->untouched >= PARALLEL_VALIDATION_MIN_SIZE) ? 0 : 1);
+
+      if (!isScanned || context.isLeaked || context.reserved != list->reserved)
+        error = LIST_FREE_SEQUENCE_IS_BROKEN;
+    }
+
+  free(visited);
+
+  return error;
+}
+
+template <typename T, typename IndexT>
+static unsigned validateMainSequence(const BasicList<T, IndexT> *list, unsigned long long *visited)
+{
+  if (!hasStorage(list))
+    return 0;
+
+  IndexT curr = nullindex;
+
+  if (visited)
+    markVisited(visited, nullindex);
+
+  for (size_t i = 0; i < list->size; ++i)
+    {
+      IndexT next = list_next(list, curr);
+
+      if (next <= nullindex || list->untouched <= (size_t)next)
+        return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+      if (visited && markVisited(visited, next))
+        return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+      if (list_prev(list, next) != curr)
+        return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+      if ((list->isLinear || i < list->defragPosition) && next != curr + 1)
+        return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+      if (list->orderIndex && findPosition(list->orderIndex, next) != i)
+        return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+      curr = next;
+    }
+
+  if (curr != list_tail(list))
+    return LIST_NOT_TAIL;
+
+  if (list->defragPosition > list->size)
+    return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+  if (list->orderIndex && getOrderIndexSize(list->orderIndex) != list->size)
+    return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+  if (list_next(list, curr) != nullindex)
+    return LIST_MAIN_SEQUENCE_IS_BROKEN;
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static unsigned validateFreeSequence(const BasicList<T, IndexT> *list, unsigned long long *visited)
+{
+  if (list->free < nullindex || list->untouched <= (size_t)list->free)
+    return LIST_NOT_FREE;
+
+  IndexT prev = POISON_PREV;
+
+  for (IndexT curr = list->free; curr != nullindex; curr = list_next(list, curr))
+    {
+      if (curr < nullindex || list->untouched <= (size_t)curr)
+        return LIST_FREE_SEQUENCE_IS_BROKEN;
+
+      if (markVisited(visited, curr) || list_prev(list, curr) != prev)
+        return LIST_FREE_SEQUENCE_IS_BROKEN;
+
+      prev = getFreePrev(curr);
+    }
+
+  return 0;
+}
+
+template <typename IndexT>
+static int markVisited(unsigned long long *visited, IndexT index)
+{
+  unsigned long long bit = 1ull << ((size_t)index % VISITED_WORD_BITS);
+
+  unsigned long long *word = &visited[(size_t)index / VISITED_WORD_BITS];
+
+  int isVisited = (*word & bit) != 0;
+
+  *word |= bit;
+
+  return isVisited;
+}
+
+template <typename T, typename IndexT>
+static void scanCells(void *context, size_t taskIndex)
+{
+  ValidationContext<T, IndexT> *ctx = (ValidationContext<T, IndexT> *)context;
+
+  const BasicList<T, IndexT> *list = ctx->list;
+
+  size_t begin = taskIndex*PARALLEL_CHUNK_SIZE;
+  size_t end   = (list->untouched - begin < PARALLEL_CHUNK_SIZE) ? list->untouched : begin + PARALLEL_CHUNK_SIZE;
+
+  size_t reserved = 0;
+  int    isLeaked = 0;
+
+  for (size_t i = begin; i < end && !isLeaked; ++i)
+    {
+      unsigned long long word = ctx->visited[i / VISITED_WORD_BITS];
+
+      if (i % VISITED_WORD_BITS == 0 && !~word && end - i >= VISITED_WORD_BITS)
+        {
+          i += VISITED_WORD_BITS - 1;
+
+          continue;
+        }
+
+      if (word >> (i % VISITED_WORD_BITS) & 1)
+        continue;
+
+      if (isReservedCell(list, (IndexT)i))
+        ++reserved;
+      else
+        isLeaked = 1;
+    }
+
+  __atomic_add_fetch(&ctx->reserved, reserved, __ATOMIC_RELAXED);
+
+  if (isLeaked)
+    __atomic_store_n(&ctx->isLeaked, 1, __ATOMIC_RELAXED);
+}
+
+template <typename T, typename IndexT>
+void do_initList(BasicList<T, IndexT> *list, size_t capacity, DebugInfo info, int *error, ListStorage storage)
+{
+  if (!isPointerCorrect(list))
+    {
+      if (isPointerCorrect(error))
+        *error = -1;
+
+      return;
+    }
+
+  list->data   = nullptr;
+  list->elems  = nullptr;
+  list->nexts  = nullptr;
+  list->prevs  = nullptr;
+  list->chunks = nullptr;
+
+  list->file     = nullptr;
+  list->fileSize = 0;
+
+  list->orderIndex = nullptr;
+
+  list->journal = nullptr;
+
+  list->policy = BASIC_DEFAULT_CAPACITY_POLICY<IndexT>;
+
+  list->capacity = capacity + 1;
+  list->size     = 0;
+
+  list->defragPosition = 0;
+  list->untouched      = 0;
+  list->reserved       = 0;
+  list->free = nullindex;
+
+  list->validationLevel = DEFAULT_VALIDATION_LEVEL_;
+  list->storage         = storage;
+  list->isLinear        = 1;
+
+#ifdef NEED_CANARY_
+
+  list->leftCanary  = LEFT_CANARY;
+  list->rightCanary = RIGHT_CANARY;
+
+#endif
+
+#ifdef NEED_HASH_
+
+  list->hash     = nullhash;
+  list->dataHash = nullhash;
+
+  list->hashKind = DEFAULT_HASH_KIND_;
+
+  list->hashTree       = nullptr;
+  list->hashTreeLeaves = 0;
+
+#endif
+
+#ifdef DEBUG_BUILD_
+
+  list->info = info;
+
+#endif
+
+  if (list->capacity)
+    {
+      createDataArray(list, list->capacity, error);
+
+      if (!hasStorage(list))
+        return;
+    }
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void destroyList(BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error);
+
+  freeStorage(list);
+
+  destroyOrderIndex(list->orderIndex);
+
+  list->orderIndex = nullptr;
+
+  int journalError = closeJournal(list->journal);
+
+  list->journal = nullptr;
+
+  list->capacity = 0;
+  list->size     = 0;
+
+  list->defragPosition = 0;
+  list->untouched      = 0;
+  list->reserved       = 0;
+  list->free = nullindex;
+
+#ifdef NEED_HASH_
+
+  free(list->hashTree);
+
+  list->hash     = nullhash;
+  list->dataHash = nullhash;
+
+  list->hashTree       = nullptr;
+  list->hashTreeLeaves = 0;
+
+#endif
+
+  if (journalError)
+    ERROR();
+}
+
+template <typename T, typename IndexT>
+void list_resize(BasicList<T, IndexT> *list, size_t newCapacity, int restoreLinearity, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (restoreLinearity)
+    {
+      int err = 0;
+
+      list_restoreLinearity(list, newCapacity, &err);
+
+      CHECK_ERROR(err, error);
+
+      UPDATE_HASH(list);
+
+      CHECK_VALID(list, error);
+
+      return;
+    }
+
+  if (resizeStorage(list, newCapacity))
+    ERROR();
+
+  UPDATE_HASH(list);
+
+  if (writeJournal(list, {.type = LIST_JOURNAL_RESIZE, .value = newCapacity}))
+    ERROR();
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_restoreLinearity(BasicList<T, IndexT> *list, size_t newCapacity, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (list->reserved)
+    ERROR();
+
+  if (!list->capacity)
+    return;
+
+  if (newCapacity <= list->size)
+    newCapacity = list->capacity;
+
+  BasicList<T, IndexT> temp = *list;
+
+  if (allocStorage(&temp, newCapacity))
+    {
+      freeStorage(&temp);
+
+      ERROR();
+    }
+
+  writeRankedNodes(list, &temp);
+
+  freeStorage(list);
+
+  list->data   = temp.data;
+  list->elems  = temp.elems;
+  list->nexts  = temp.nexts;
+  list->prevs  = temp.prevs;
+  list->chunks = temp.chunks;
+
+  list->file     = temp.file;
+  list->fileSize = temp.fileSize;
+
+  list->capacity  = newCapacity;
+  list->untouched = list->size + 1;
+
+  list->free = nullindex;
+
+  list->isLinear       = 1;
+  list->defragPosition = list->size;
+
+  if (list->orderIndex)
+    {
+      if (resizeOrderIndex(list->orderIndex, newCapacity))
+        ERROR();
+
+      buildOrderIndex(list->orderIndex, list);
+    }
+
+#ifdef NEED_HASH_
+
+  if (buildHashTree(list))
+    ERROR();
+
+#endif
+
+  UPDATE_HASH(list);
+
+  if (writeJournal(list, {.type = LIST_JOURNAL_RESTORE, .value = newCapacity}))
+    ERROR();
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_saveToFile(const BasicList<T, IndexT> *list, const char *fileName, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (list->reserved || !isPointerCorrect(fileName) || writeListFile(list, fileName))
+    ERROR();
+}
+
+template <typename T, typename IndexT>
+void do_list_mapFromFile(BasicList<T, IndexT> *list, const char *fileName, DebugInfo info, int *error)
+{
+  int err = 0;
+
+  do_initList(list, 0, info, &err);
+
+  CHECK_ERROR(err, error);
+
+  BasicList<T, IndexT> mapped = *list;
+
+  const hash_t *blockHashes = nullptr;
+
+  if (!isPointerCorrect(fileName) || mapListFile(&mapped, fileName, &blockHashes))
+    ERROR();
+
+  freeStorage(list);
+
+#ifdef NEED_HASH_
+
+  free(list->hashTree);
+
+  mapped.hashTree       = nullptr;
+  mapped.hashTreeLeaves = 0;
+
+#endif
+
+  *list = mapped;
+
+#ifdef NEED_HASH_
+
+  if (resizeHashTree(list, list->capacity))
+    ERROR();
+
+  size_t blockCount = getHashBlockCount(list->capacity);
+
+  memcpy(list->hashTree + list->hashTreeLeaves, blockHashes, blockCount*sizeof(hash_t));
+
+  sumHashTree(list->hashTree, list->hashTreeLeaves, blockCount);
+
+#else
+
+  (void)blockHashes;
+
+#endif
+
+  UPDATE_HASH(list);
+
+  unsigned errorCode = validateList(list, LIST_VALIDATE_FAST);
+
+  if (errorCode)
+    {
+      dumpList(list, errorCode, lockLogFile());
+
+      unlockLogFile();
+
+      if (isPointerCorrect(error))
+        *error = (int)errorCode;
+    }
+}
+
+template <typename T, typename IndexT>
+void list_enableJournal(BasicList<T, IndexT> *list, const char *journalName, const char *snapshotName,
+                        ListJournalPolicy policy, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (list->reserved || !isPointerCorrect(journalName) || !isPointerCorrect(snapshotName))
+    ERROR();
+
+  ListJournal *journal = openJournal(journalName, snapshotName, policy);
+
+  if (!journal)
+    ERROR();
+
+  closeJournal(list->journal);
+
+  list->journal = journal;
+
+  UPDATE_HASH(list);
+
+  if (checkpointJournal(list))
+    ERROR();
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_disableJournal(BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error);
+
+  int err = closeJournal(list->journal);
+
+  list->journal = nullptr;
+
+  UPDATE_HASH(list);
+
+  CHECK_ERROR(err, error);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_syncJournal(BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!list->journal || flushJournal(list->journal, 1))
+    ERROR();
+}
+
+template <typename T, typename IndexT>
+void list_checkpoint(BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!list->journal || checkpointJournal(list))
+    ERROR();
+}
+
+template <typename T, typename IndexT>
+void do_list_recover(BasicList<T, IndexT> *list, const char *snapshotName, const char *journalName,
+                     DebugInfo info, int *error)
+{
+  int err = 0;
+
+  do_list_mapFromFile(list, snapshotName, info, &err);
+
+  CHECK_ERROR(err, error);
+
+  hash_t snapshotHash = nullhash;
+
+  if (!isPointerCorrect(journalName) || readListFileHash<IndexT>(snapshotName, &snapshotHash))
+    ERROR();
+
+  int validationLevel = list->validationLevel;
+
+  if (validationLevel > LIST_VALIDATE_FAST)
+    list->validationLevel = LIST_VALIDATE_FAST;
+
+  UPDATE_HASH(list);
+
+  err = replayJournal(journalName, snapshotHash, replayJournalRecord<T, IndexT>, list);
+
+  list->validationLevel = validationLevel;
+
+  UPDATE_HASH(list);
+
+  CHECK_ERROR(err, error);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+static void createDataArray(BasicList<T, IndexT> *list, size_t capacity, int *error)
+{
+  if (!capacity)
+    return;
+
+  if (allocStorage(list, capacity))
+    {
+      freeStorage(list);
+
+      ERROR();
+    }
+
+  T poison = ElementTraits<T>::poison();
+
+  writeNode(list, nullindex, BasicNode<T, IndexT> {.elem = poison, .next = 0, .prev = 0});
+
+  list->free      = nullindex;
+  list->untouched = 1;
+
+#ifdef NEED_HASH_
+
+  if (buildHashTree(list))
+    ERROR();
+
+#endif
+}
+
+#ifdef NEED_HASH_
+
+template <typename T, typename IndexT>
+static hash_t getStructHash(const BasicList<T, IndexT> *list)
+{
+  return getHashFunction((HashKind)list->hashKind)(list, &list->hash);
+}
+
+template <typename T, typename IndexT>
+static hash_t getNodeHash(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  BasicNode<T, IndexT> node = readNode(list, index);
+
+  return getCellHash(&node, &node + 1, (size_t)index, getHashFunction((HashKind)list->hashKind));
+}
+
+template <typename T, typename IndexT>
+void list_setHashKind(BasicList<T, IndexT> *list, HashKind kind, int *error)
+{
+  CHECK_VALID(list, error);
+
+  list->hashKind = kind;
+
+  if (list->capacity && buildHashTree(list))
+    ERROR();
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+static hash_t getBlockHash(const BasicList<T, IndexT> *list, size_t block)
+{
+  size_t start = block*HASH_BLOCK_SIZE;
+  size_t end   = start + HASH_BLOCK_SIZE;
+
+  if (end > list->untouched)
+    end = list->untouched;
+
+  if (start >= end)
+    return nullhash;
+
+  if (list->storage == LIST_STORAGE_AOS)
+    return getCellsHash(list->data + start, sizeof(BasicNode<T, IndexT>), end - start, start,
+                        (HashKind)list->hashKind);
+
+  if (list->storage == LIST_STORAGE_CHUNKED && start >> STORAGE_CHUNK_SHIFT == (end - 1) >> STORAGE_CHUNK_SHIFT)
+    return getCellsHash(list_chunkNode(list, (IndexT)start), sizeof(BasicNode<T, IndexT>), end - start, start,
+                        (HashKind)list->hashKind);
+
+  BasicNode<T, IndexT> nodes[HASH_BLOCK_SIZE] = {};
+
+  for (size_t i = start; i < end; ++i)
+    nodes[i - start] = readNode(list, (IndexT)i);
+
+  return getCellsHash(nodes, sizeof(BasicNode<T, IndexT>), end - start, start, (HashKind)list->hashKind);
+}
+
+static inline size_t getHashBlockCount(size_t capacity)
+{
+  return (capacity + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+}
+
+template <typename T, typename IndexT>
+static int buildHashTree(BasicList<T, IndexT> *list)
+{
+  free(list->hashTree);
+
+  list->hashTree       = nullptr;
+  list->hashTreeLeaves = 0;
+  list->dataHash       = nullhash;
+
+  if (resizeHashTree(list, list->capacity))
+    return -1;
+
+  size_t blockCount = getHashBlockCount(list->untouched);
+
+  for (size_t i = 0; i < blockCount; ++i)
+    list->hashTree[list->hashTreeLeaves + i] = getBlockHash(list, i);
+
+  sumHashTree(list->hashTree, list->hashTreeLeaves, blockCount);
+
+  list->dataHash = list->hashTree[1];
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int resizeHashTree(BasicList<T, IndexT> *list, size_t newCapacity)
+{
+  size_t blockCount = getHashBlockCount(newCapacity);
+
+  size_t leaves = 1;
+
+  while (leaves < blockCount)
+    leaves *= 2;
+
+  if (leaves == list->hashTreeLeaves)
+    return 0;
+
+  hash_t *tree = (hash_t *)calloc(2*leaves, sizeof(hash_t));
+
+  if (!tree)
+    return -1;
+
+  size_t savedLeaves = (leaves < list->hashTreeLeaves) ? leaves : list->hashTreeLeaves;
+
+  size_t touchedLeaves = getHashBlockCount(list->untouched);
+
+  if (savedLeaves > touchedLeaves)
+    savedLeaves = touchedLeaves;
+
+  for (size_t i = 0; i < savedLeaves; ++i)
+    tree[leaves + i] = list->hashTree[list->hashTreeLeaves + i];
+
+  sumHashTree(tree, leaves, savedLeaves);
+
+  free(list->hashTree);
+
+  list->hashTree       = tree;
+  list->hashTreeLeaves = leaves;
+
+  return 0;
+}
+
+static inline void sumHashTree(hash_t *tree, size_t leaves, size_t count)
+{
+  if (!count)
+    return;
+
+  for (size_t first = leaves/2, last = (leaves + count - 1)/2; first > 0; first /= 2, last /= 2)
+    for (size_t i = first; i <= last; ++i)
+      tree[i] = tree[2*i] + tree[2*i + 1];
+}
+
+template <typename T, typename IndexT>
+static void changeDataHash(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index, hash_t delta)
+{
+  list->dataHash += delta;
+
+  if (!list->hashTree)
+    return;
+
+  for (size_t i = list->hashTreeLeaves + (size_t)index / HASH_BLOCK_SIZE; i > 0; i /= 2)
+    list->hashTree[i] += delta;
+}
+
+template <typename T, typename IndexT>
+static int isHashTreeCorrect(const BasicList<T, IndexT> *list)
+{
+  if (!isPointerCorrect(list->hashTree))
+    return !list->capacity;
+
+  for (size_t i = list->hashTreeLeaves - 1; i > 0; --i)
+    if (list->hashTree[i] != list->hashTree[2*i] + list->hashTree[2*i + 1])
+      return 0;
+
+  return list_findBrokenHashBlock(list) == getHashBlockCount(list->capacity);
+}
+
+template <typename T, typename IndexT>
+size_t list_findBrokenHashBlock(const BasicList<T, IndexT> *list, size_t startBlock)
+{
+  assert(list);
+
+  size_t blockCount = getHashBlockCount(list->capacity);
+
+  if (!hasStorage(list) || !isPointerCorrect(list->hashTree))
+    return blockCount;
+
+  for (size_t i = startBlock; i < blockCount; ++i)
+    if (getBlockHash(list, i) != list->hashTree[list->hashTreeLeaves + i])
+      return i;
+
+  return blockCount;
+}
+
+#endif
+
+template <typename T, typename IndexT>
+static void setNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<BasicNode<T, IndexT>> node)
+{
+#ifdef NEED_HASH_
+
+  hash_t oldHash = getNodeHash(list, index);
+
+#endif
+
+  writeNode(list, index, node);
+
+#ifdef NEED_HASH_
+
+  changeDataHash(list, index, getNodeHash(list, index) - oldHash);
+
+#endif
+}
+
+template <typename T, typename IndexT>
+static void setNext(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<IndexT> next)
+{
+  BasicNode<T, IndexT> node = readNode(list, index);
+
+  node.next = next;
+
+  setNode(list, index, node);
+}
+
+template <typename T, typename IndexT>
+static void setPrev(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                    std::type_identity_t<IndexT> prev)
+{
+  BasicNode<T, IndexT> node = readNode(list, index);
+
+  node.prev = prev;
+
+  setNode(list, index, node);
+}
+
+template <typename T, typename IndexT>
+static int isElementOrNull(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (index < 0 || list->capacity <= (size_t)index)
+    return 0;
+
+  return !isFreeCell(list, index);
+}
+
+template <typename T, typename IndexT>
+static int isFreeCell(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  return list->untouched <= (size_t)index || list_prev(list, index) < 0;
+}
+
+template <typename T, typename IndexT>
+static int isReservedCell(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (index <= nullindex || list->untouched <= (size_t)index)
+    return 0;
+
+  return list_prev(list, index) == POISON_PREV && list_next(list, index) == index;
+}
+
+template <typename IndexT>
+static IndexT getFreePrev(IndexT index)
+{
+  return POISON_PREV - index;
+}
+
+template <typename T, typename IndexT>
+static void touchCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  writeNode(list, index, BasicNode<T, IndexT> {
+    .elem = ElementTraits<T>::poison(),
+    .next = nullindex,
+    .prev = POISON_PREV
+  });
+
+#ifdef NEED_HASH_
+
+  changeDataHash(list, index, getNodeHash(list, index));
+
+#endif
+}
+
+template <typename T, typename IndexT>
+static IndexT peekFreeCell(const BasicList<T, IndexT> *list)
+{
+  if (list->free != nullindex || list->untouched >= list->capacity)
+    return list->free;
+
+  return (IndexT)list->untouched;
+}
+
+template <typename T, typename IndexT>
+static int resizeStorage(BasicList<T, IndexT> *list, size_t newCapacity)
+{
+  int isShrink = newCapacity < list->capacity;
+
+#ifdef NEED_HASH_
+
+  if (!isShrink && resizeHashTree(list, newCapacity))
+    return -1;
+
+#endif
+
+  if (!isShrink && list->orderIndex && resizeOrderIndex(list->orderIndex, newCapacity))
+    {
+      UPDATE_HASH(list);
+
+      return -1;
+    }
+
+#ifdef NEED_HASH_
+
+  for (size_t i = newCapacity; i < list->untouched; ++i)
+    changeDataHash(list, (IndexT)i, -getNodeHash(list, (IndexT)i));
+
+#endif
+
+  if (reallocStorage(list, newCapacity))
+    {
+#ifdef NEED_HASH_
+
+      for (size_t i = newCapacity; i < list->untouched; ++i)
+        changeDataHash(list, (IndexT)i, getNodeHash(list, (IndexT)i));
+
+#endif
+
+      UPDATE_HASH(list);
+
+      return -1;
+    }
+
+  if (list->untouched > newCapacity)
+    list->untouched = newCapacity;
+
+  list->capacity = newCapacity;
+
+  if (!isShrink)
+    return 0;
+
+#ifdef NEED_HASH_
+
+  resizeHashTree(list, newCapacity);
+
+#endif
+
+  if (list->orderIndex)
+    resizeOrderIndex(list->orderIndex, newCapacity);
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int reserveCells(BasicList<T, IndexT> *list, size_t count)
+{
+  size_t used = list->size + list->reserved + count;
+
+  if (used < list->capacity)
+    return 0;
+
+  size_t newCapacity = (size_t)((double)list->capacity*list->policy.growthFactor);
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    newCapacity = (used / STORAGE_CHUNK_SIZE + 1)*STORAGE_CHUNK_SIZE;
+
+  if (newCapacity <= used)
+    newCapacity = used + 1;
+
+  if (resizeStorage(list, newCapacity))
+    return -1;
+
+  return writeJournal(list, {.type = LIST_JOURNAL_RESIZE, .value = newCapacity});
+}
+
+template <typename T, typename IndexT>
+static int shrinkIfNeeded(BasicList<T, IndexT> *list)
+{
+  const BasicListCapacityPolicy<IndexT> *policy = &list->policy;
+
+  if (list->reserved || (double)list->size >= policy->shrinkLoad*(double)list->capacity)
+    return 0;
+
+  size_t newCapacity = (size_t)((double)list->size*policy->growthFactor) + 1;
+
+  if (newCapacity < policy->minCapacity)
+    newCapacity = policy->minCapacity;
+
+  if (newCapacity >= list->capacity)
+    return 0;
+
+  if (shrinkStorage(list, newCapacity, policy->relocation, policy->argument))
+    return -1;
+
+  return writeJournal(list, {.type = LIST_JOURNAL_SHRINK, .value = newCapacity});
+}
+
+template <typename T, typename IndexT>
+static int shrinkStorage(BasicList<T, IndexT> *list, size_t newCapacity,
+                         std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument)
+{
+  for (size_t i = newCapacity; i < list->untouched; ++i)
+    if (isFreeCell(list, (IndexT)i))
+      unlinkFreeCell(list, (IndexT)i);
+
+  for (size_t i = newCapacity; i < list->untouched; ++i)
+    {
+      if (isFreeCell(list, (IndexT)i))
+        continue;
+
+      IndexT index = takeFreeCell(list);
+
+      moveNode(list, (IndexT)i, index);
+
+      if (relocation)
+        relocation(argument, (IndexT)i, index);
+    }
+
+  return resizeStorage(list, newCapacity);
+}
+
+template <typename T, typename IndexT>
+static void updateLinearity(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                            std::type_identity_t<IndexT> index, size_t size)
+{
+  if (anchor != (IndexT)size || index != anchor + 1)
+    list->isLinear = 0;
+}
+
+template <typename T, typename IndexT>
+static void updateDefragPosition(BasicList<T, IndexT> *list, size_t count)
+{
+  if (count < list->defragPosition)
+    list->defragPosition = count;
+}
+
+template <typename T, typename IndexT>
+static void moveNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> from,
+                     std::type_identity_t<IndexT> to)
+{
+  BasicNode<T, IndexT> node = readNode(list, from);
+
+  setNode(list, to, node);
+
+  setNext(list, node.prev, to);
+  setPrev(list, node.next, to);
+
+  if (list->orderIndex)
+    relocateInOrderIndex(list->orderIndex, from, to);
+}
+
+template <typename T, typename IndexT>
+static size_t getPositionAfter(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor)
+{
+  if (anchor == nullindex)
+    return 0;
+
+  return findPosition(list->orderIndex, anchor) + 1;
+}
+
+template <typename T, typename IndexT>
+static size_t getKnownPosition(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->isLinear)
+    return (size_t)index - 1;
+
+  return findPosition(list->orderIndex, index);
+}
+
+template <typename T, typename IndexT>
+static int isRangeMovable(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                          std::type_identity_t<IndexT> last, std::type_identity_t<IndexT> anchor)
+{
+  if (list->isLinear || list->orderIndex)
+    {
+      size_t firstPosition = getKnownPosition(list, first);
+      size_t lastPosition  = getKnownPosition(list, last);
+
+      if (firstPosition > lastPosition)
+        return 0;
+
+      if (anchor == nullindex)
+        return 1;
+
+      size_t anchorPosition = getKnownPosition(list, anchor);
+
+      return anchorPosition < firstPosition || lastPosition < anchorPosition;
+    }
+
+  for (IndexT curr = first; curr != last; curr = list_next(list, curr))
+    if (curr == nullindex || curr == anchor)
+      return 0;
+
+  return 1;
+}
+
+template <typename T, typename IndexT>
+static IndexT takeFreeCell(BasicList<T, IndexT> *list)
+{
+  if (list->free == nullindex)
+    {
+      IndexT index = (IndexT)list->untouched;
+
+      unlinkFreeCell(list, index);
+
+      return index;
+    }
+
+  IndexT index = list->free;
+
+  list->free = list_next(list, index);
+
+  if (list->free != nullindex)
+    setPrev(list, list->free, POISON_PREV);
+
+  return index;
+}
+
+template <typename T, typename IndexT>
+static void freeCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->free != nullindex)
+    setPrev(list, list->free, getFreePrev(index));
+
+  setNode(list, index,
+          {
+            .elem = ElementTraits<T>::poison(),
+            .next = list->free,
+            .prev = POISON_PREV
+          });
+
+  list->free = index;
+}
+
+template <typename T, typename IndexT>
+static void unlinkFreeCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->untouched <= (size_t)index)
+    {
+      for ( ; list->untouched < (size_t)index; ++list->untouched)
+        {
+          touchCell(list, (IndexT)list->untouched);
+
+          freeCell(list, (IndexT)list->untouched);
+        }
+
+      touchCell(list, index);
+
+      list->untouched = (size_t)index + 1;
+
+      return;
+    }
+
+  IndexT prev = POISON_PREV - list_prev(list, index);
+  IndexT next = list_next(list, index);
+
+  if (prev == nullindex)
+    list->free = next;
+  else
+    setNext(list, prev, next);
+
+  if (next != nullindex)
+    setPrev(list, next, getFreePrev(prev));
+}
+
+template <typename T, typename IndexT>
+static void linkCell(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                     std::type_identity_t<IndexT> index, std::type_identity_t<T> element)
+{
+  updateLinearity(list, anchor, index, list->size);
+
+  updateDefragPosition(list, (size_t)anchor);
+
+  setNode(list, index,
+          {
+            .elem = element,
+            .next = list_next(list, anchor),
+            .prev = anchor
+          });
+
+  setPrev(list, list_next(list, anchor), index);
+
+  setNext(list, anchor, index);
+
+  if (!list->size)
+    setNext(list, nullindex, index);
+
+  ++list->size;
+
+  if (list->orderIndex)
+    insertToOrderIndex(list->orderIndex, getPositionAfter(list, anchor), list, index, 1);
+}
+
+template <typename T, typename IndexT>
+static void unlinkRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                        std::type_identity_t<IndexT> last)
+{
+  IndexT prev = list_prev(list, first);
+  IndexT next = list_next(list, last);
+
+  setNext(list, prev, next);
+  setPrev(list, next, prev);
+}
+
+template <typename T, typename IndexT>
+static void linkRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                      std::type_identity_t<IndexT> first, std::type_identity_t<IndexT> last)
+{
+  IndexT next = list_next(list, anchor);
+
+  setNext(list, anchor, first);
+  setPrev(list, first,  anchor);
+  setNext(list, last,   next);
+  setPrev(list, next,   last);
+}
+
+template <typename T, typename IndexT>
+static void linearizeNodes(BasicList<T, IndexT> *list)
+{
+  IndexT curr = list_head(list);
+
+  for (size_t i = 1; i <= list->size; ++i)
+    {
+      if (curr != (IndexT)i)
+        swapNodes(list, curr, (IndexT)i);
+
+      curr = list_next(list, (IndexT)i);
+    }
+
+  list->free      = nullindex;
+  list->untouched = list->size + 1;
+}
+
+template <typename T, typename IndexT>
+static void swapNodes(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> from,
+                      std::type_identity_t<IndexT> target)
+{
+  BasicNode<T, IndexT> moved = readNode(list, from);
+  BasicNode<T, IndexT> other = {
+    .elem = ElementTraits<T>::poison(),
+    .next = nullindex,
+    .prev = POISON_PREV
+  };
+
+  int isOtherElement = !isFreeCell(list, target);
+
+  if (isOtherElement)
+    {
+      other = readNode(list, target);
+
+      writeNode(list, from, BasicNode<T, IndexT> {
+        .elem = other.elem,
+        .next = getSwappedIndex(other.next, from, target),
+        .prev = getSwappedIndex(other.prev, from, target)
+      });
+    }
+  else
+    writeNode(list, from, other);
+
+  writeNode(list, target, BasicNode<T, IndexT> {
+    .elem = moved.elem,
+    .next = getSwappedIndex(moved.next, from, target),
+    .prev = getSwappedIndex(moved.prev, from, target)
+  });
+
+  BasicNode<T, IndexT> node = {};
+
+  if (moved.prev != target)
+    {
+      node = readNode(list, moved.prev);
+      node.next = target;
+      writeNode(list, moved.prev, node);
+    }
+
+  if (moved.next != target)
+    {
+      node = readNode(list, moved.next);
+      node.prev = target;
+      writeNode(list, moved.next, node);
+    }
+
+  if (isOtherElement && other.prev != from)
+    {
+      node = readNode(list, other.prev);
+      node.next = from;
+      writeNode(list, other.prev, node);
+    }
+
+  if (isOtherElement && other.next != from)
+    {
+      node = readNode(list, other.next);
+      node.prev = from;
+      writeNode(list, other.next, node);
+    }
+}
+
+template <typename IndexT>
+static IndexT getSwappedIndex(IndexT index, IndexT first, IndexT second)
+{
+  if (index == first)
+    return second;
+
+  if (index == second)
+    return first;
+
+  return index;
+}
+
+template <typename T, typename IndexT>
+static int writeJournal(BasicList<T, IndexT> *list,
+                        std::type_identity_t<BasicListJournalRecord<IndexT>> record,
+                        const std::type_identity_t<T> *elements, size_t count)
+{
+  if (!list->journal)
+    return 0;
+
+  if (appendJournalRecord(list->journal, record, elements, count))
+    return -1;
+
+  if (isCheckpointNeeded(list->journal))
+    return checkpointJournal(list);
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int checkpointJournal(BasicList<T, IndexT> *list)
+{
+  if (!list->journal)
+    return 0;
+
+  hash_t snapshotHash = nullhash;
+
+  if (writeListFile(list, list->journal->snapshotName, &snapshotHash) ||
+      resetJournal(list->journal, snapshotHash))
+    return -1;
+
+  if (list->capacity == list->untouched)
+    return 0;
+
+  return appendJournalRecord<T, IndexT>(list->journal, BasicListJournalRecord<IndexT> {
+                                          .type  = LIST_JOURNAL_RESIZE,
+                                          .value = list->capacity
+                                        }, nullptr, 0);
+}
+
+template <typename T, typename IndexT>
+static int replayJournalRecord(void *argument, const BasicListJournalRecord<IndexT> *record,
+                               const T *elements)
+{
+  BasicList<T, IndexT> *list = (BasicList<T, IndexT> *)argument;
+
+  int err = 0;
+
+  switch (record->type)
+    {
+    case LIST_JOURNAL_INSERT:
+      {
+        IndexT first = list_insertRange(list, record->anchor, elements, record->count, &err);
+
+        (void)first;
+
+        break;
+      }
+    case LIST_JOURNAL_REMOVE:
+      {
+        T element = {};
+
+        list_removeElement(list, record->anchor, &element, &err);
+
+        break;
+      }
+    case LIST_JOURNAL_MOVE:
+      list_moveRange(list, record->first, record->last, record->anchor, &err);
+      break;
+    case LIST_JOURNAL_RESIZE:
+      list_resize(list, record->value, 0, &err);
+      break;
+    case LIST_JOURNAL_RESTORE:
+      list_restoreLinearity(list, record->value, &err);
+      break;
+    case LIST_JOURNAL_SHRINK:
+      err = shrinkStorage(list, record->value, nullptr, nullptr);
+
+      UPDATE_HASH(list);
+      break;
+    case LIST_JOURNAL_DEFRAG:
+      list_defragStep(list, record->value, nullptr, nullptr, &err);
+      break;
+    default:
+      err = -1;
+      break;
+    }
+
+  return err;
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_insertElement(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                          std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  if (!isElementOrNull(list, anchor))
+    ERROR(nullindex);
+
+  if (reserveCells(list, 1))
+    ERROR(nullindex);
+
+  IndexT firstFreeIndex = takeFreeCell(list);
+
+  linkCell(list, anchor, firstFreeIndex, *element);
+
+  UPDATE_HASH(list);
+
+  if (writeJournal(list, {.type = LIST_JOURNAL_INSERT, .anchor = anchor}, element, 1))
+    ERROR(firstFreeIndex);
+
+  CHECK_VALID(list, error, nullindex);
+
+  return firstFreeIndex;
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushBackElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  return list_insertElement(list, list_tail(list), element, error);
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushFrontElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  IndexT result = list_insertElement(list, 0, element, error);
+
+  setNext(list, nullindex, result);
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error, nullindex);
+
+  return result;
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_insertRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                        const std::type_identity_t<T> *elements, size_t count, int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  if (!count)
+    return nullindex;
+
+  if (!elements || !isElementOrNull(list, anchor))
+    ERROR(nullindex);
+
+  if (reserveCells(list, count))
+    ERROR(nullindex);
+
+  updateDefragPosition(list, (size_t)anchor);
+
+  IndexT first = peekFreeCell(list);
+  IndexT last  = anchor;
+  IndexT next  = list_next(list, anchor);
+
+  for (size_t i = 0; i < count; ++i)
+    {
+      IndexT curr = takeFreeCell(list);
+
+      updateLinearity(list, last, curr, list->size + i);
+
+      setNode(list, curr,
+              {
+                .elem = elements[i],
+                .next = (i + 1 == count) ? next : peekFreeCell(list),
+                .prev = last
+              });
+
+      last = curr;
+    }
+
+  setPrev(list, next,   last);
+  setNext(list, anchor, first);
+
+  list->size += count;
+
+  if (list->orderIndex)
+    insertToOrderIndex(list->orderIndex, getPositionAfter(list, anchor), list, first, count);
+
+  UPDATE_HASH(list);
+
+  if (writeJournal(list, {.type = LIST_JOURNAL_INSERT, .anchor = anchor}, elements, count))
+    ERROR(first);
+
+  CHECK_VALID(list, error, nullindex);
+
+  return first;
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushBackRange(BasicList<T, IndexT> *list, const std::type_identity_t<T> *elements, size_t count,
+                          int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  return list_insertRange(list, list_tail(list), elements, count, error);
+}
+
+template <typename T, typename IndexT>
+[[nodiscard("Return value need for work with list functions!")]]
+IndexT list_pushFrontRange(BasicList<T, IndexT> *list, const std::type_identity_t<T> *elements, size_t count,
+                           int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  return list_insertRange(list, nullindex, elements, count, error);
+}
+
+template <typename T, typename IndexT>
+void list_reserveSlots(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> *indexes, size_t count,
+                       int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!indexes || list->journal)
+    ERROR();
+
+  if (reserveCells(list, count))
+    ERROR();
+
+  T poison = ElementTraits<T>::poison();
+
+  for (size_t i = 0; i < count; ++i)
+    {
+      IndexT index = takeFreeCell(list);
+
+      setNode(list, index, {.elem = poison, .next = index, .prev = POISON_PREV});
+
+      indexes[i] = index;
+    }
+
+  list->reserved += count;
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_insertSlot(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                     std::type_identity_t<IndexT> index, const std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!element || !isElementOrNull(list, anchor) || !isReservedCell(list, index))
+    ERROR();
+
+  linkCell(list, anchor, index, *element);
+
+  --list->reserved;
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+void list_releaseSlot(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!isReservedCell(list, index))
+    ERROR();
+
+  freeCell(list, index);
+
+  --list->reserved;
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+IndexT list_splice(BasicList<T, IndexT> *destination, std::type_identity_t<IndexT> anchor,
+                   BasicList<T, IndexT> *source, std::type_identity_t<IndexT> first,
+                   std::type_identity_t<IndexT> last, int *error)
+{
+  if (destination == source)
+    {
+      int err = 0;
+
+      list_moveRange(destination, first, last, anchor, &err);
+
+      CHECK_ERROR(err, error, nullindex);
+
+      return err ? nullindex : first;
+    }
+
+  CHECK_VALID(destination, error, nullindex);
+  CHECK_VALID(source,      error, nullindex);
+
+  if (!isElementOrNull(destination, anchor))
+    ERROR(nullindex);
+
+  if (first == nullindex || last == nullindex ||
+      !isElementOrNull(source, first) || !isElementOrNull(source, last))
+    ERROR(nullindex);
+
+  size_t count = 1;
+
+  for (IndexT curr = first; curr != last; ++count)
+    {
+      curr = list_next(source, curr);
+
+      if (curr == nullindex)
+        ERROR(nullindex);
+    }
+
+  if (reserveCells(destination, count))
+    ERROR(nullindex);
+
+  if (last != list_tail(source))
+    source->isLinear = 0;
+
+  updateDefragPosition(source,      (size_t)first - 1);
+  updateDefragPosition(destination, (size_t)anchor);
+
+  if (source->orderIndex)
+    removeFromOrderIndex(source->orderIndex, findPosition(source->orderIndex, first), count);
+
+  unlinkRange(source, first, last);
+
+  IndexT destinationFirst = peekFreeCell(destination);
+  IndexT destinationLast  = anchor;
+  IndexT destinationNext  = list_next(destination, anchor);
+
+  IndexT curr = first;
+
+  for (size_t i = 0; i < count; ++i)
+    {
+      IndexT index = takeFreeCell(destination);
+
+      updateLinearity(destination, destinationLast, index, destination->size + i);
+
+      setNode(destination, index,
+              {
+                .elem = *list_element(source, curr),
+                .next = (i + 1 == count) ? destinationNext : peekFreeCell(destination),
+                .prev = destinationLast
+              });
+
+      destinationLast = index;
+
+      IndexT next = list_next(source, curr);
+
+      freeCell(source, curr);
+
+      curr = next;
+    }
+
+  setPrev(destination, destinationNext, destinationLast);
+  setNext(destination, anchor,          destinationFirst);
+
+  if (destination->orderIndex)
+    insertToOrderIndex(destination->orderIndex, getPositionAfter(destination, anchor),
+                       destination, destinationFirst, count);
+
+  destination->size += count;
+  source->size      -= count;
+
+  if (!source->size)
+    source->isLinear = 1;
+
+  if (shrinkIfNeeded(source))
+    ERROR(nullindex);
+
+  UPDATE_HASH(destination);
+  UPDATE_HASH(source);
+
+  if (checkpointJournal(destination) || checkpointJournal(source))
+    ERROR(destinationFirst);
+
+  CHECK_VALID(destination, error, nullindex);
+  CHECK_VALID(source,      error, nullindex);
+
+  return destinationFirst;
+}
+
+template <typename T, typename IndexT>
+void list_moveRange(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> first,
+                    std::type_identity_t<IndexT> last, std::type_identity_t<IndexT> anchor, int *error)
+{
+  CHECK_VALID(list, error, );
+
+  if (!isElementOrNull(list, anchor))
+    ERROR();
+
+  if (first == nullindex || last == nullindex ||
+      !isElementOrNull(list, first) || !isElementOrNull(list, last))
+    ERROR();
+
+  if (anchor == first || anchor == last || !isRangeMovable(list, first, last, anchor))
+    ERROR();
+
+  if (list_prev(list, first) == anchor)
+    return;
+
+  if (list->orderIndex)
+    {
+      size_t position    = findPosition(list->orderIndex, first);
+      size_t count       = findPosition(list->orderIndex, last) - position + 1;
+      size_t newPosition = getPositionAfter(list, anchor);
+
+      if (newPosition > position)
+        newPosition -= count;
+
+      moveInOrderIndex(list->orderIndex, position, count, newPosition);
+    }
+
+  updateDefragPosition(list, (size_t)first - 1);
+  updateDefragPosition(list, (size_t)anchor);
+
+  unlinkRange(list, first, last);
+  linkRange  (list, anchor, first, last);
+
+  list->isLinear = 0;
+
+  UPDATE_HASH(list);
+
+  if (writeJournal(list, {
+        .type   = LIST_JOURNAL_MOVE,
+        .anchor = anchor,
+        .first  = first,
+        .last   = last
+      }))
+    ERROR();
+
+  CHECK_VALID(list, error, );
+}
+
+template <typename T, typename IndexT>
+void list_split(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                BasicList<T, IndexT> *newList, int *error)
+{
+  CHECK_VALID(list, error, );
+
+  if (list == newList || !isElementOrNull(list, anchor))
+    ERROR();
+
+  IndexT last = list_tail(list);
+
+  if (anchor == last)
+    return;
+
+  int err = 0;
+
+  IndexT index =
+    list_splice(newList, list_tail(newList), list, list_next(list, anchor), last, &err);
+
+  (void)index;
+
+  CHECK_ERROR(err, error, );
+}
+
+template <typename T, typename IndexT>
+void list_sort(BasicList<T, IndexT> *list, std::type_identity_t<basic_element_compare_t<T>> compare,
+               int *error)
+{
+  CHECK_VALID(list, error, );
+
+  if (!compare || list->reserved)
+    ERROR();
+
+  if (!list->capacity)
+    return;
+
+  size_t threadCount = (list->size >= PARALLEL_SORT_MIN_SIZE) ? getParallelThreadCount() : 1;
+
+  if (sortLinks(list, compare, threadCount))
+    ERROR();
+
+  linearizeNodes(list);
+
+  list->isLinear       = 1;
+  list->defragPosition = list->size;
+
+  if (list->orderIndex)
+    buildOrderIndex(list->orderIndex, list);
+
+#ifdef NEED_HASH_
+
+  if (buildHashTree(list))
+    ERROR();
+
+#endif
+
+  UPDATE_HASH(list);
+
+  if (checkpointJournal(list))
+    ERROR();
+
+  CHECK_VALID(list, error, );
+}
+
+template <typename T, typename IndexT>
+void list_parallelForEach(const BasicList<T, IndexT> *list,
+                          std::type_identity_t<basic_list_visitor_t<T, IndexT>> visitor, void *argument,
+                          int *error)
+{
+  CHECK_VALID(list, error, );
+
+  if (!visitor)
+    ERROR();
+
+  size_t chunkCount = 0;
+  IndexT *starts   = nullptr;
+
+  if (prepareChunks(list, &chunkCount, &starts))
+    ERROR();
+
+  ParallelListContext<T, IndexT> context = {
+    .list     = list,
+    .starts   = starts,
+    .visitor  = visitor,
+    .argument = argument
+  };
+
+  int err = runParallel(visitChunk<T, IndexT>, &context, chunkCount);
+
+  free(starts);
+
+  if (err)
+    ERROR();
+}
+
+template <typename T, typename IndexT>
+void list_parallelTransform(BasicList<T, IndexT> *list,
+                            std::type_identity_t<basic_list_transform_t<T, IndexT>> transform, void *argument,
+                            int *error)
+{
+  CHECK_VALID(list, error, );
+
+  if (!transform)
+    ERROR();
+
+  if (!list->size)
+    return;
+
+  size_t chunkCount = 0;
+  IndexT *starts   = nullptr;
+
+  if (prepareChunks(list, &chunkCount, &starts))
+    ERROR();
+
+  ParallelTransformContext<T, IndexT> context = {
+    .list      = list,
+    .starts    = starts,
+    .transform = transform,
+    .argument  = argument
+  };
+
+  int err = runParallel(transformChunk<T, IndexT>, &context, chunkCount);
+
+  free(starts);
+
+#ifdef NEED_HASH_
+
+  sumHashTree(list->hashTree, list->hashTreeLeaves, getHashBlockCount(list->untouched));
+
+  list->dataHash = list->hashTree[1];
+
+#endif
+
+  UPDATE_HASH(list);
+
+  if (err || checkpointJournal(list))
+    ERROR();
+
+  CHECK_VALID(list, error, );
+}
+
+template <typename T, typename IndexT>
+void list_merge(BasicList<T, IndexT> *destination, BasicList<T, IndexT> *source,
+                std::type_identity_t<basic_element_compare_t<T>> compare, int *error)
+{
+  CHECK_VALID(destination, error, );
+  CHECK_VALID(source,      error, );
+
+  if (!compare || destination == source)
+    ERROR();
+
+  if (!source->size)
+    return;
+
+  if (reserveCells(destination, source->size))
+    ERROR();
+
+  IndexT anchor = nullindex;
+  IndexT curr   = list_head(source);
+
+  size_t inserted = 0;
+
+  while (curr != nullindex)
+    {
+      const T *element = list_element(source, curr);
+
+      IndexT next = list_next(destination, anchor);
+
+      while (next != nullindex && compare(list_element(destination, next), element) <= 0)
+        {
+          anchor = next;
+          next   = list_next(destination, next);
+        }
+
+      IndexT index = takeFreeCell(destination);
+
+      updateLinearity(destination, anchor, index, destination->size + inserted++);
+
+      updateDefragPosition(destination, (size_t)anchor);
+
+      setNode(destination, index, {.elem = *element, .next = next, .prev = anchor});
+
+      setNext(destination, anchor, index);
+      setPrev(destination, next,   index);
+
+      if (destination->orderIndex)
+        insertToOrderIndex(destination->orderIndex, getPositionAfter(destination, anchor),
+                           destination, index, 1);
+
+      anchor = index;
+
+      IndexT sourceNext = list_next(source, curr);
+
+      freeCell(source, curr);
+
+      curr = sourceNext;
+    }
+
+  setNext(source, nullindex, nullindex);
+  setPrev(source, nullindex, nullindex);
+
+  destination->size += source->size;
+  source->size       = 0;
+
+  source->isLinear       = 1;
+  source->defragPosition = 0;
+
+  if (source->orderIndex)
+    removeFromOrderIndex(source->orderIndex, 0, getOrderIndexSize(source->orderIndex));
+
+  if (shrinkIfNeeded(source))
+    ERROR();
+
+  UPDATE_HASH(destination);
+  UPDATE_HASH(source);
+
+  if (checkpointJournal(destination) || checkpointJournal(source))
+    ERROR();
+
+  CHECK_VALID(destination, error, );
+  CHECK_VALID(source,      error, );
+}
+
+template <typename T, typename IndexT>
+T *list_get(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+            std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullptr);
+
+  if (anchor == nullindex)
+    ERROR(nullptr);
+
+  if (anchor < 0 || list->capacity <= (size_t)anchor)
+    ERROR(nullptr);
+
+  if (isFreeCell(list, anchor))
+    ERROR(nullptr);
+
+  *element = *list_element(list, anchor);
+
+  CHECK_VALID(list, error, nullptr);
+
+  return element;
+}
+
+template <typename T, typename IndexT>
+T *list_removeElement(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> anchor,
+                      std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullptr);
+
+  if (!element)
+    ERROR(nullptr);
+
+  if (!list->size)
+    ERROR(nullptr);
+
+  if (anchor == nullindex || !isElementOrNull(list, anchor))
+    ERROR(nullptr);
+
+  *element = *list_element(list, anchor);
+
+  if (anchor != list_tail(list))
+    list->isLinear = 0;
+
+  updateDefragPosition(list, (size_t)anchor - 1);
+
+  if (list->orderIndex)
+    removeFromOrderIndex(list->orderIndex, findPosition(list->orderIndex, anchor), 1);
+
+  IndexT next = list_next(list, anchor);
+  IndexT prev = list_prev(list, anchor);
+
+  setPrev(list, next, prev);
+  setNext(list, prev, next);
+
+  if (anchor == list_head(list))
+    setNext(list, nullindex, next);
+
+  freeCell(list, anchor);
+
+  --list->size;
+
+  if (!list->size)
+    {
+      setNext(list, nullindex, nullindex);
+
+      list->isLinear = 1;
+    }
+
+  if (writeJournal(list, {.type = LIST_JOURNAL_REMOVE, .anchor = anchor}) ||
+      shrinkIfNeeded(list))
+    ERROR(nullptr);
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error, nullptr);
+
+  return element;
+}
+
+template <typename T, typename IndexT>
+T *list_popBackElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullptr);
+
+  return list_removeElement(list, list_tail(list), element, error);
+}
+
+template <typename T, typename IndexT>
+T *list_popFrontElement(BasicList<T, IndexT> *list, std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullptr);
+
+  return list_removeElement(list, list_head(list), element, error);
+}
+
+template <typename T, typename IndexT>
+size_t list_size(const BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error, 0);
+
+  return list->size;
+}
+
+template <typename T, typename IndexT>
+IndexT list_indexOf(const BasicList<T, IndexT> *list, size_t position, int *error)
+{
+  CHECK_VALID(list, error, nullindex);
+
+  if (position >= list->size)
+    ERROR(nullindex);
+
+  if (list->isLinear)
+    return (IndexT)position + 1;
+
+  if (list->orderIndex)
+    return findByPosition(list->orderIndex, position);
+
+  IndexT curr = nullindex;
+
+  if (position < list->size / 2)
+    for (size_t i = 0; i <= position; ++i)
+      curr = list_next(list, curr);
+  else
+    for (size_t i = list->size; i > position; --i)
+      curr = list_prev(list, curr);
+
+  return curr;
+}
+
+template <typename T, typename IndexT>
+T *list_getAt(const BasicList<T, IndexT> *list, size_t position, std::type_identity_t<T> *element, int *error)
+{
+  CHECK_VALID(list, error, nullptr);
+
+  if (!element)
+    ERROR(nullptr);
+
+  int err = 0;
+
+  IndexT index = list_indexOf(list, position, &err);
+
+  if (err)
+    ERROR(nullptr);
+
+  *element = *list_element(list, index);
+
+  return element;
+}
+
+template <typename T, typename IndexT>
+size_t list_positionOf(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index, int *error)
+{
+  CHECK_VALID(list, error, 0);
+
+  if (index == nullindex || !isElementOrNull(list, index))
+    ERROR(0);
+
+  if (list->isLinear)
+    return (size_t)index - 1;
+
+  if (list->orderIndex)
+    return findPosition(list->orderIndex, index);
+
+  size_t position = 0;
+
+  for (IndexT curr = list_head(list); curr != index; curr = list_next(list, curr))
+    ++position;
+
+  return position;
+}
+
+template <typename T, typename IndexT>
+void list_setCapacityPolicy(BasicList<T, IndexT> *list,
+                            std::type_identity_t<BasicListCapacityPolicy<IndexT>> policy, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (policy.growthFactor <= 1 || policy.shrinkLoad < 0 ||
+      policy.shrinkLoad*policy.growthFactor >= 1)
+    ERROR();
+
+  list->policy = policy;
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+size_t list_defragStep(BasicList<T, IndexT> *list, size_t budget,
+                       std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument,
+                       int *error)
+{
+  return defragList(list, budget, 0, relocation, argument, error);
+}
+
+template <typename T, typename IndexT>
+size_t list_defragFor(BasicList<T, IndexT> *list, unsigned long long timeBudget,
+                      std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument,
+                      int *error)
+{
+  return defragList(list, SIZE_MAX, getMonotonicTime() + timeBudget, relocation, argument, error);
+}
+
+template <typename T, typename IndexT>
+static size_t defragList(BasicList<T, IndexT> *list, size_t budget, unsigned long long deadline,
+                         std::type_identity_t<basic_list_relocation_t<IndexT>> relocation, void *argument,
+                         int *error)
+{
+  CHECK_VALID(list, error, 0);
+
+  if (list->reserved)
+    ERROR(list->size - list->defragPosition);
+
+  size_t checked       = 0;
+  size_t startPosition = list->defragPosition;
+  int    wasLinear     = list->isLinear;
+
+  if (list->isLinear)
+    list->defragPosition = list->size;
+
+  IndexT curr = list_next(list, (IndexT)list->defragPosition);
+
+  for ( ; checked < budget && list->defragPosition < list->size; ++checked)
+    {
+      if (deadline && checked && checked % DEFRAG_CLOCK_PERIOD == 0 && getMonotonicTime() >= deadline)
+        break;
+
+      IndexT target = (IndexT)list->defragPosition + 1;
+
+      if (curr != target)
+        {
+          if (!isFreeCell(list, target))
+            {
+              IndexT freeIndex = peekFreeCell(list);
+
+              if (freeIndex == nullindex)
+                break;
+
+              unlinkFreeCell(list, freeIndex);
+
+              moveNode(list, target, freeIndex);
+
+              if (relocation)
+                relocation(argument, target, freeIndex);
+            }
+          else
+            unlinkFreeCell(list, target);
+
+          moveNode(list, curr, target);
+
+          freeCell(list, curr);
+
+          if (relocation)
+            relocation(argument, curr, target);
+        }
+
+      ++list->defragPosition;
+
+      curr = list_next(list, target);
+    }
+
+  if (list->defragPosition == list->size)
+    list->isLinear = 1;
+
+  UPDATE_HASH(list);
+
+  if ((list->defragPosition != startPosition || list->isLinear != wasLinear) &&
+      writeJournal(list, {.type = LIST_JOURNAL_DEFRAG, .value = checked}))
+    ERROR(list->size - list->defragPosition);
+
+  CHECK_VALID(list, error, 0);
+
+  return list->size - list->defragPosition;
+}
+
+template <typename T, typename IndexT>
+void list_enableOrderIndex(BasicList<T, IndexT> *list, int enable, int *error)
+{
+  CHECK_VALID(list, error);
+
+  if (!enable)
+    {
+      destroyOrderIndex(list->orderIndex);
+
+      list->orderIndex = nullptr;
+    }
+  else if (!list->orderIndex)
+    {
+      list->orderIndex = createOrderIndex<IndexT>(list->capacity);
+
+      if (!list->orderIndex)
+        ERROR();
+
+      buildOrderIndex(list->orderIndex, list);
+    }
+
+  UPDATE_HASH(list);
+
+  CHECK_VALID(list, error);
+}
+
+template <typename T, typename IndexT>
+size_t list_capacity(const BasicList<T, IndexT> *list, int *error)
+{
+  CHECK_VALID(list, error, 0);
+
+  return list->capacity;
+}
+
+template <typename T, typename IndexT>
+static IndexT *partitionList(const BasicList<T, IndexT> *list, size_t chunkCount)
+{
+  IndexT *starts = (IndexT *)calloc(chunkCount, sizeof(IndexT));
+
+  if (!starts)
+    return nullptr;
+
+  IndexT curr = list_head(list);
+
+  for (size_t i = 0; i < list->size; ++i, curr = list_next(list, curr))
+    if (i % PARALLEL_CHUNK_SIZE == 0)
+      starts[i / PARALLEL_CHUNK_SIZE] = curr;
+
+  return starts;
+}
+
+template <typename T, typename IndexT>
+static int prepareChunks(const BasicList<T, IndexT> *list, size_t *chunkCount,
+                         std::type_identity_t<IndexT> **starts)
+{
+  *chunkCount = (list->size + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+  *starts     = nullptr;
+
+  if (list->isLinear || !*chunkCount)
+    return 0;
+
+  *starts = partitionList(list, *chunkCount);
+
+  return *starts ? 0 : -1;
+}
+
+template <typename T, typename IndexT>
+static void visitChunk(void *context, size_t taskIndex)
+{
+  const ParallelListContext<T, IndexT> *ctx = (const ParallelListContext<T, IndexT> *)context;
+
+  const BasicList<T, IndexT> *list = ctx->list;
+
+  size_t first = taskIndex*PARALLEL_CHUNK_SIZE;
+  size_t count = (list->size - first < PARALLEL_CHUNK_SIZE) ? list->size - first : PARALLEL_CHUNK_SIZE;
+
+  IndexT curr = ctx->starts ? ctx->starts[taskIndex] : (IndexT)first + 1;
+
+  for (size_t i = 0; i < count; ++i)
+    {
+      ctx->visitor(ctx->argument, curr, list_element(list, curr));
+
+      curr = ctx->starts ? list_next(list, curr) : curr + 1;
+    }
+}
+
+template <typename T, typename IndexT>
+static void transformChunk(void *context, size_t taskIndex)
+{
+  const ParallelTransformContext<T, IndexT> *ctx = (const ParallelTransformContext<T, IndexT> *)context;
+
+  BasicList<T, IndexT> *list = ctx->list;
+
+  size_t first = taskIndex*PARALLEL_CHUNK_SIZE;
+  size_t count = (list->size - first < PARALLEL_CHUNK_SIZE) ? list->size - first : PARALLEL_CHUNK_SIZE;
+
+  IndexT curr = ctx->starts ? ctx->starts[taskIndex] : (IndexT)first + 1;
+
+#ifdef NEED_HASH_
+
+  size_t block      = (size_t)curr / HASH_BLOCK_SIZE;
+  hash_t blockDelta = nullhash;
+
+#endif
+
+  for (size_t i = 0; i < count; ++i)
+    {
+#ifdef NEED_HASH_
+
+      if ((size_t)curr / HASH_BLOCK_SIZE != block)
+        {
+          __atomic_add_fetch(&list->hashTree[list->hashTreeLeaves + block], blockDelta, __ATOMIC_RELAXED);
+
+          block      = (size_t)curr / HASH_BLOCK_SIZE;
+          blockDelta = nullhash;
+        }
+
+      hash_t oldHash = getNodeHash(list, curr);
+
+#endif
+
+      ctx->transform(ctx->argument, curr, list_element(list, curr));
+
+#ifdef NEED_HASH_
+
+      blockDelta += getNodeHash(list, curr) - oldHash;
+
+#endif
+
+      curr = ctx->starts ? list_next(list, curr) : curr + 1;
+    }
+
+#ifdef NEED_HASH_
+
+  __atomic_add_fetch(&list->hashTree[list->hashTreeLeaves + block], blockDelta, __ATOMIC_RELAXED);
+
+#endif
+}
+
+template <typename T, typename IndexT>
+static void writeRankedNodes(const BasicList<T, IndexT> *list, BasicList<T, IndexT> *temp)
+{
+  T poison = ElementTraits<T>::poison();
+
+  writeNode(temp, nullindex, BasicNode<T, IndexT> {
+    .elem = poison,
+    .next = list->size ? 1 : nullindex,
+    .prev = (IndexT)list->size
+  });
+
+  if (list->size >= PARALLEL_RANKING_MIN_SIZE && getParallelThreadCount() > 1 &&
+      !writeRankedNodesParallel(list, temp))
+    return;
+
+  IndexT curr = list_head(list);
+
+  for (size_t i = 1; i <= list->size; ++i, curr = list_next(list, curr))
+    writeNode(temp, (IndexT)i, BasicNode<T, IndexT> {
+      .elem = *list_element(list, curr),
+      .next = (i == list->size) ? nullindex : (IndexT)i + 1,
+      .prev = (IndexT)i - 1
+    });
+}
+
+template <typename T, typename IndexT>
+static int writeRankedNodesParallel(const BasicList<T, IndexT> *list, BasicList<T, IndexT> *temp)
+{
+  size_t slotCount = (list->untouched - 1) / RANKING_RULER_SPACING + 2;
+
+  RankingRuler *rulers = (RankingRuler *)calloc(slotCount, sizeof(RankingRuler));
+
+  if (!rulers)
+    return -1;
+
+  IndexT head = list_head(list);
+
+  for (size_t i = 1; i < slotCount - 1; ++i)
+    rulers[i].isRuler = !isFreeCell(list, (IndexT)(i*RANKING_RULER_SPACING));
+
+  rulers[slotCount - 1].isRuler = (size_t)head % RANKING_RULER_SPACING != 0;
+
+  RankingContext<T, IndexT> context = {
+    .list      = list,
+    .temp      = temp,
+    .rulers    = rulers,
+    .slotCount = slotCount
+  };
+
+  if (runParallel(measureSublist<T, IndexT>, &context, slotCount))
+    {
+      free(rulers);
+
+      return -1;
+    }
+
+  size_t slot = rulers[slotCount - 1].isRuler ? slotCount - 1 : (size_t)head / RANKING_RULER_SPACING;
+
+  for (size_t position = 0; slot < slotCount; slot = rulers[slot].next)
+    {
+      rulers[slot].offset = position;
+
+      position += rulers[slot].length;
+    }
+
+  int error = runParallel(scatterSublist<T, IndexT>, &context, slotCount);
+
+  free(rulers);
+
+  return error ? -1 : 0;
+}
+
+template <typename T, typename IndexT>
+static IndexT getRulerIndex(const RankingContext<T, IndexT> *context, size_t slot)
+{
+  if (slot == context->slotCount - 1)
+    return list_head(context->list);
+
+  return (IndexT)(slot*RANKING_RULER_SPACING);
+}
+
+template <typename T, typename IndexT>
+static void measureSublist(void *context, size_t taskIndex)
+{
+  const RankingContext<T, IndexT> *ctx = (const RankingContext<T, IndexT> *)context;
+
+  RankingRuler *ruler = &ctx->rulers[taskIndex];
+
+  if (!ruler->isRuler)
+    return;
+
+  size_t length = 1;
+
+  IndexT next = list_next(ctx->list, getRulerIndex(ctx, taskIndex));
+
+  for ( ; next != nullindex && (size_t)next % RANKING_RULER_SPACING != 0; next = list_next(ctx->list, next))
+    ++length;
+
+  ruler->length = length;
+  ruler->next   = (next != nullindex) ? (size_t)next / RANKING_RULER_SPACING : ctx->slotCount;
+}
+
+template <typename T, typename IndexT>
+static void scatterSublist(void *context, size_t taskIndex)
+{
+  const RankingContext<T, IndexT> *ctx = (const RankingContext<T, IndexT> *)context;
+
+  const RankingRuler *ruler = &ctx->rulers[taskIndex];
+
+  if (!ruler->isRuler)
+    return;
+
+  const BasicList<T, IndexT> *list = ctx->list;
+
+  IndexT curr = getRulerIndex(ctx, taskIndex);
+
+  for (size_t i = ruler->offset + 1; i <= ruler->offset + ruler->length; ++i, curr = list_next(list, curr))
+    writeNode(ctx->temp, (IndexT)i, BasicNode<T, IndexT> {
+      .elem = *list_element(list, curr),
+      .next = (i == list->size) ? nullindex : (IndexT)i + 1,
+      .prev = (IndexT)i - 1
+    });
+}
+
+#undef UPDATE_HASH
+
+#undef ERROR
+#undef CHECK_ERROR
+#undef CHECK_VALID
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef LISTJOURNAL_H_
+#define LISTJOURNAL_H_
+
+#include "list.h"
+
+/// Magic number at start of List journal, "LJRN" in file
+const unsigned LIST_JOURNAL_MAGIC = 0x4E524A4C;
+
+/// Version of format of List journal
+const unsigned LIST_JOURNAL_VERSION = 1;
+
+/// Kinds of records of List journal
+enum ListJournalRecordType {
+  LIST_JOURNAL_INSERT  = 1, /// <- list_insertRange(anchor, elements, count)
+  LIST_JOURNAL_REMOVE  = 2, /// <- list_removeElement(anchor)
+  LIST_JOURNAL_MOVE    = 3, /// <- list_moveRange(first, last, anchor)
+  LIST_JOURNAL_RESIZE  = 4, /// <- list_resize(value) without restore of linearity, also growth and
+                            ///    capacity of checkpoint which isn`t saved in file
+  LIST_JOURNAL_RESTORE = 5, /// <- list_restoreLinearity(value)
+  LIST_JOURNAL_SHRINK  = 6, /// <- Shrink by ListCapacityPolicy to capacity value
+  LIST_JOURNAL_DEFRAG  = 7, /// <- list_defragStep(value), value is count of checked elements, also for
+                            ///    list_defragFor()
+};
+
+/// Header of List journal
+struct ListJournalHeader {
+  unsigned magic;      /// <- LIST_JOURNAL_MAGIC
+  unsigned version;    /// <- LIST_JOURNAL_VERSION
+  hash_t snapshotHash; /// <- ListFileHeader::hash of checkpoint which records are applied to
+  hash_t hash;         /// <- CRC32C of header from ::magic to ::hash
+};
+
+/// Record of List journal, it is followed by count elements
+template <typename IndexT>
+struct BasicListJournalRecord {
+  hash_t hash;    /// <- CRC32C of record from ::type to end of elements
+  unsigned type;  /// <- ListJournalRecordType
+  IndexT anchor;  /// <- Index of anchor Node
+  IndexT first;   /// <- Index of first moved Node
+  IndexT last;    /// <- Index of last moved Node
+  unsigned count; /// <- Count of elements after record
+  size_t value;   /// <- Capacity or budget
+};
+
+typedef BasicListJournalRecord<index_t> ListJournalRecord;
+
+/// Journal of changes of List
+struct ListJournal {
+  int fileDescriptor;       /// <- Descriptor of journal file opened for append
+  char *snapshotName;       /// <- Name of checkpoint file
+  ListJournalPolicy policy; /// <- Rules of writes, syncs and checkpoints
+  unsigned char *buffer;    /// <- Records which aren`t written yet
+  size_t bufferSize;        /// <- Size of records in buffer
+  size_t bufferCapacity;    /// <- Capacity of buffer
+  size_t recordCount;       /// <- Count of records in buffer
+  size_t writeCount;        /// <- Count of writes after last sync
+  size_t fileSize;          /// <- Size of journal file with written records
+};
+
+/// Function which applies record to list at replay
+template <typename T, typename IndexT>
+using basic_journal_replay_t = int (*)(void *argument, const BasicListJournalRecord<IndexT> *record,
+                                       const T *elements);
+
+typedef basic_journal_replay_t<element_t, index_t> journal_replay_t;
+
+/// Open journal file for append
+/// @param [in] journalName Name of journal file
+/// @param [in] snapshotName Name of checkpoint file
+/// @param [in] policy Rules of writes, syncs and checkpoints
+/// @return Journal or nullptr if was error
+/// @note Journal has to be reset by resetJournal() before records
+ListJournal *openJournal(const char *journalName, const char *snapshotName, ListJournalPolicy policy);
+
+/// Write buffered records, sync and close journal
+/// @param [in/out] journal Journal or nullptr
+/// @return 0 if all records were written else -1
+int closeJournal(ListJournal *journal);
+
+/// Add record to buffer of journal and write group of records by ListJournalPolicy
+/// @param [in/out] journal Journal
+/// @param [in] record Record, its ::hash and ::count are set by function
+/// @param [in] elements Elements of record
+/// @param [in] count Count of elements
+/// @return 0 if record was added else -1
+template <typename T, typename IndexT>
+int appendJournalRecord(ListJournal *journal, BasicListJournalRecord<IndexT> record,
+                        const T *elements, size_t count);
+
+/// Write buffered records of journal
+/// @param [in/out] journal Journal
+/// @param [in] sync Make fsync() after write
+/// @return 0 if records were written else -1
+int flushJournal(ListJournal *journal, int sync);
+
+/// Drop all records and bind journal to checkpoint
+/// @param [in/out] journal Journal
+/// @param [in] snapshotHash ListFileHeader::hash of checkpoint
+/// @return 0 if journal was reset else -1
+int resetJournal(ListJournal *journal, hash_t snapshotHash);
+
+/// Check that journal is larger than ListJournalPolicy::checkpointSize
+/// @param [in] journal Journal
+/// @return 1 if checkpoint is needed else 0
+int isCheckpointNeeded(const ListJournal *journal);
+
+/// Call replay for each correct record of journal file
+/// @param [in] journalName Name of journal file
+/// @param [in] snapshotHash ListFileHeader::hash of checkpoint which is replayed on
+/// @param [in] replay Function which applies record
+/// @param [in/out] argument Argument for replay
+/// @return 0 if all records were applied else -1
+/// @note Missing journal or journal of other checkpoint has no records,
+/// records after first broken one are lost at crash and are skipped
+template <typename T, typename IndexT>
+int replayJournal(const char *journalName, hash_t snapshotHash, basic_journal_replay_t<T, IndexT> replay,
+                  void *argument);
+
+#include "listjournalimpl.h"
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef LISTJOURNALIMPL_H_
+#define LISTJOURNALIMPL_H_
+
+#include "list.h"
+#include "listjournal.h"
+
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+
+#include "systemlike.h"
+
+/// Hash of header from ListJournalHeader::magic to ListJournalHeader::hash
+static inline hash_t getJournalHeaderHash(const ListJournalHeader *header);
+
+/// Hash of record with elements after it from ListJournalRecord::type
+template <typename T, typename IndexT>
+static hash_t getJournalRecordHash(const BasicListJournalRecord<IndexT> *record);
+
+/// Size of record with count elements, next record and elements are aligned
+template <typename T, typename IndexT>
+static size_t getJournalRecordSize(size_t count);
+
+template <typename T, typename IndexT>
+int appendJournalRecord(ListJournal *journal, BasicListJournalRecord<IndexT> record,
+                        const T *elements, size_t count)
+{
+  if (count > UINT_MAX)
+    return -1;
+
+  size_t size = getJournalRecordSize<T, IndexT>(count);
+
+  if (journal->bufferSize + size > journal->bufferCapacity)
+    {
+      size_t capacity = 2*(journal->bufferSize + size);
+
+      unsigned char *buffer = (unsigned char *)realloc(journal->buffer, capacity);
+
+      if (!buffer)
+        return -1;
+
+      journal->buffer         = buffer;
+      journal->bufferCapacity = capacity;
+    }
+
+  BasicListJournalRecord<IndexT> *written =
+    (BasicListJournalRecord<IndexT> *)(journal->buffer + journal->bufferSize);
+
+  memset(written, 0, size);
+
+  record.count = (unsigned)count;
+
+  memcpy(written, &record, sizeof(record));
+
+  if (count)
+    memcpy(written + 1, elements, count*sizeof(T));
+
+  written->hash = getJournalRecordHash<T>(written);
+
+  journal->bufferSize += size;
+
+  if (++journal->recordCount >= journal->policy.groupSize)
+    return flushJournal(journal, 0);
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+int replayJournal(const char *journalName, hash_t snapshotHash, basic_journal_replay_t<T, IndexT> replay,
+                  void *argument)
+{
+  if (!isFileExists(journalName))
+    return 0;
+
+  size_t fileSize = 0;
+
+  unsigned char *file = (unsigned char *)mapFile(journalName, &fileSize);
+
+  if (!file)
+    return fileSize ? -1 : 0;
+
+  const ListJournalHeader *header = (const ListJournalHeader *)file;
+
+  if (fileSize < sizeof(ListJournalHeader)           ||
+      header->magic   != LIST_JOURNAL_MAGIC          ||
+      header->version != LIST_JOURNAL_VERSION        ||
+      header->hash    != getJournalHeaderHash(header) ||
+      header->snapshotHash != snapshotHash)
+    {
+      mapFree(file, fileSize);
+
+      return 0;
+    }
+
+  int error = 0;
+
+  size_t offset = sizeof(ListJournalHeader);
+
+  while (!error && fileSize - offset >= sizeof(BasicListJournalRecord<IndexT>))
+    {
+      const BasicListJournalRecord<IndexT> *record = (const BasicListJournalRecord<IndexT> *)(file + offset);
+
+      size_t size = getJournalRecordSize<T, IndexT>(record->count);
+
+      if (fileSize - offset < size || record->hash != getJournalRecordHash<T>(record))
+        break;
+
+      error = replay(argument, record, (const T *)(record + 1));
+
+      offset += size;
+    }
+
+  mapFree(file, fileSize);
+
+  return error ? -1 : 0;
+}
+
+static inline hash_t getJournalHeaderHash(const ListJournalHeader *header)
+{
+  return getCrc32cHash(header, &header->hash);
+}
+
+template <typename T, typename IndexT>
+static hash_t getJournalRecordHash(const BasicListJournalRecord<IndexT> *record)
+{
+  return getCrc32cHash(&record->type, (const T *)(record + 1) + record->count);
+}
+
+template <typename T, typename IndexT>
+static size_t getJournalRecordSize(size_t count)
+{
+  const size_t align = (alignof(T) > alignof(BasicListJournalRecord<IndexT>)) ?
+                       alignof(T) : alignof(BasicListJournalRecord<IndexT>);
+
+  size_t size = sizeof(BasicListJournalRecord<IndexT>) + count*sizeof(T);
+
+  return (size + align - 1) / align * align;
+}
+
+#endif
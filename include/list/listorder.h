@@ -0,0 +1,106 @@
+#ifndef LISTORDER_H_
+#define LISTORDER_H_
+
+#include "list.h"
+
+/// Order-statistic tree of Nodes of BasicList by their positions
+/// @note It is treap with implicit keys, Node with index i is vertex i,
+/// nullindex is empty vertex
+template <typename IndexT>
+struct BasicOrderIndex {
+  IndexT   *left;     /// <- Left child of vertex
+  IndexT   *right;    /// <- Right child of vertex
+  IndexT   *parent;   /// <- Parent of vertex, nullindex for root
+  IndexT   *count;    /// <- Count of vertexes in subtree
+  unsigned *priority; /// <- Heap priority of vertex
+  IndexT   *stack;    /// <- Buffer for build of tree
+
+  size_t capacity; /// <- Count of vertexes in arrays
+
+  IndexT   root; /// <- Root of tree
+  unsigned seed; /// <- State of generator of priorities
+};
+
+typedef BasicOrderIndex<index_t> OrderIndex;
+
+/// Constructor for BasicOrderIndex
+/// @param [in] capacity Count of vertexes, equal to List::capacity
+/// @return Pointer to BasicOrderIndex or nullptr if was error
+template <typename IndexT>
+BasicOrderIndex<IndexT> *createOrderIndex(size_t capacity);
+
+/// Destructor for BasicOrderIndex
+/// @param [in] tree BasicOrderIndex from createOrderIndex()
+template <typename IndexT>
+void destroyOrderIndex(BasicOrderIndex<IndexT> *tree);
+
+/// Realloc arrays of tree with saving vertexes
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] capacity New count of vertexes
+/// @return 0 if arrays were reallocated else -1
+/// @note On error some arrays may be reallocated, but each of them keeps at least min of old and new capacity
+template <typename IndexT>
+int resizeOrderIndex(BasicOrderIndex<IndexT> *tree, size_t capacity);
+
+/// Make tree from main sequence of list
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] list List
+template <typename T, typename IndexT>
+void buildOrderIndex(BasicOrderIndex<IndexT> *tree, const BasicList<T, IndexT> *list);
+
+/// Insert count Nodes which follow one by one in list from first
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] position Position of first inserted Node
+/// @param [in] list List
+/// @param [in] first Index of first inserted Node
+/// @param [in] count Count of inserted Nodes
+template <typename T, typename IndexT>
+void insertToOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, const BasicList<T, IndexT> *list,
+                        std::type_identity_t<IndexT> first, size_t count);
+
+/// Remove count Nodes from position
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] position Position of first removed Node
+/// @param [in] count Count of removed Nodes
+template <typename IndexT>
+void removeFromOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, size_t count);
+
+/// Move count Nodes from position to newPosition
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] position Position of first moved Node
+/// @param [in] count Count of moved Nodes
+/// @param [in] newPosition Position of first moved Node among other Nodes
+template <typename IndexT>
+void moveInOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, size_t count, size_t newPosition);
+
+/// Move Node to other index in tree
+/// @param [in/out] tree BasicOrderIndex
+/// @param [in] from Index of Node which is in tree
+/// @param [in] to New index of Node which isn`t in tree
+template <typename IndexT>
+void relocateInOrderIndex(BasicOrderIndex<IndexT> *tree, std::type_identity_t<IndexT> from,
+                          std::type_identity_t<IndexT> to);
+
+/// Get index of Node at position
+/// @param [in] tree BasicOrderIndex
+/// @param [in] position Position of Node
+/// @return Index of Node or nullindex if position isn`t less than size
+template <typename IndexT>
+IndexT findByPosition(const BasicOrderIndex<IndexT> *tree, size_t position);
+
+/// Get position of Node
+/// @param [in] tree BasicOrderIndex
+/// @param [in] index Index of Node which is in tree
+/// @return Position of Node
+template <typename IndexT>
+size_t findPosition(const BasicOrderIndex<IndexT> *tree, std::type_identity_t<IndexT> index);
+
+/// Get count of Nodes in tree
+/// @param [in] tree BasicOrderIndex
+/// @return Count of Nodes
+template <typename IndexT>
+size_t getOrderIndexSize(const BasicOrderIndex<IndexT> *tree);
+
+#include "listorderimpl.h"
+
+#endif
@@ -0,0 +1,375 @@
+#ifndef LISTORDERIMPL_H_
+#define LISTORDERIMPL_H_
+
+#include <stdlib.h>
+#include "listorder.h"
+#include "systemlike.h"
+
+/// Start state of generator of priorities
+const unsigned ORDER_INDEX_SEED = 2463534242;
+
+/// Next priority for vertex
+template <typename IndexT>
+static unsigned getPriority(BasicOrderIndex<IndexT> *tree);
+
+/// Count of vertexes in subtree or 0 for nullindex
+template <typename IndexT>
+static size_t getCount(const BasicOrderIndex<IndexT> *tree, IndexT vertex);
+
+/// Recalculate count of vertex and set it as parent of its children
+template <typename IndexT>
+static void update(BasicOrderIndex<IndexT> *tree, IndexT vertex);
+
+/// Split subtree to first count vertexes and other
+template <typename IndexT>
+static void split(BasicOrderIndex<IndexT> *tree, IndexT vertex, size_t count, IndexT *first, IndexT *second);
+
+/// Merge subtrees where all vertexes of first are before vertexes of second
+template <typename IndexT>
+static IndexT merge(BasicOrderIndex<IndexT> *tree, IndexT first, IndexT second);
+
+/// Make subtree from count Nodes which follow one by one in list from first
+template <typename T, typename IndexT>
+static IndexT buildSubtree(BasicOrderIndex<IndexT> *tree, const BasicList<T, IndexT> *list, IndexT first,
+                          size_t count);
+
+/// Set new root of tree
+template <typename IndexT>
+static void setRoot(BasicOrderIndex<IndexT> *tree, IndexT root);
+
+template <typename IndexT>
+BasicOrderIndex<IndexT> *createOrderIndex(size_t capacity)
+{
+  BasicOrderIndex<IndexT> *tree = (BasicOrderIndex<IndexT> *)calloc(1, sizeof(BasicOrderIndex<IndexT>));
+
+  if (!tree)
+    return nullptr;
+
+  tree->root = nullindex;
+  tree->seed = ORDER_INDEX_SEED;
+
+  if (resizeOrderIndex(tree, capacity))
+    {
+      destroyOrderIndex(tree);
+
+      return nullptr;
+    }
+
+  return tree;
+}
+
+template <typename IndexT>
+void destroyOrderIndex(BasicOrderIndex<IndexT> *tree)
+{
+  if (!tree)
+    return;
+
+  free(tree->left);
+  free(tree->right);
+  free(tree->parent);
+  free(tree->count);
+  free(tree->priority);
+  free(tree->stack);
+
+  free(tree);
+}
+
+template <typename IndexT>
+int resizeOrderIndex(BasicOrderIndex<IndexT> *tree, size_t capacity)
+{
+  if (!capacity)
+    capacity = 1;
+
+  IndexT **arrays[] = {&tree->left, &tree->right, &tree->parent, &tree->count, &tree->stack};
+
+  for (size_t i = 0; i < sizeof(arrays) / sizeof(*arrays); ++i)
+    {
+      IndexT *array = (IndexT *)recalloc(*arrays[i], capacity, sizeof(IndexT));
+
+      if (!array)
+        return -1;
+
+      *arrays[i] = array;
+    }
+
+  unsigned *priority = (unsigned *)recalloc(tree->priority, capacity, sizeof(unsigned));
+
+  if (!priority)
+    return -1;
+
+  tree->priority = priority;
+  tree->capacity = capacity;
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+void buildOrderIndex(BasicOrderIndex<IndexT> *tree, const BasicList<T, IndexT> *list)
+{
+  setRoot(tree, buildSubtree(tree, list, list_head(list), list->size));
+}
+
+template <typename T, typename IndexT>
+void insertToOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, const BasicList<T, IndexT> *list,
+                        std::type_identity_t<IndexT> first, size_t count)
+{
+  IndexT before = nullindex, after = nullindex;
+
+  split(tree, tree->root, position, &before, &after);
+
+  IndexT inserted = buildSubtree(tree, list, first, count);
+
+  setRoot(tree, merge(tree, merge(tree, before, inserted), after));
+}
+
+template <typename IndexT>
+void removeFromOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, size_t count)
+{
+  IndexT before = nullindex, removed = nullindex, after = nullindex;
+
+  split(tree, tree->root, position, &before, &after);
+  split(tree, after,      count,    &removed, &after);
+
+  setRoot(tree, merge(tree, before, after));
+}
+
+template <typename IndexT>
+void moveInOrderIndex(BasicOrderIndex<IndexT> *tree, size_t position, size_t count, size_t newPosition)
+{
+  IndexT before = nullindex, moved = nullindex, after = nullindex;
+
+  split(tree, tree->root, position, &before, &after);
+  split(tree, after,      count,    &moved,  &after);
+
+  split(tree, merge(tree, before, after), newPosition, &before, &after);
+
+  setRoot(tree, merge(tree, merge(tree, before, moved), after));
+}
+
+template <typename IndexT>
+void relocateInOrderIndex(BasicOrderIndex<IndexT> *tree, std::type_identity_t<IndexT> from,
+                          std::type_identity_t<IndexT> to)
+{
+  IndexT left   = tree->left  [from];
+  IndexT right  = tree->right [from];
+  IndexT parent = tree->parent[from];
+
+  tree->left    [to] = left;
+  tree->right   [to] = right;
+  tree->parent  [to] = parent;
+  tree->count   [to] = tree->count   [from];
+  tree->priority[to] = tree->priority[from];
+
+  if (left != nullindex)
+    tree->parent[left] = to;
+
+  if (right != nullindex)
+    tree->parent[right] = to;
+
+  if (parent == nullindex)
+    tree->root = to;
+  else if (tree->left[parent] == from)
+    tree->left [parent] = to;
+  else
+    tree->right[parent] = to;
+}
+
+template <typename IndexT>
+IndexT findByPosition(const BasicOrderIndex<IndexT> *tree, size_t position)
+{
+  IndexT vertex = tree->root;
+
+  if (position >= getCount(tree, vertex))
+    return nullindex;
+
+  while (vertex != nullindex)
+    {
+      size_t leftCount = getCount(tree, tree->left[vertex]);
+
+      if (position == leftCount)
+        return vertex;
+
+      if (position < leftCount)
+        vertex = tree->left[vertex];
+      else
+        {
+          position -= leftCount + 1;
+
+          vertex = tree->right[vertex];
+        }
+    }
+
+  return nullindex;
+}
+
+template <typename IndexT>
+size_t findPosition(const BasicOrderIndex<IndexT> *tree, std::type_identity_t<IndexT> index)
+{
+  size_t position = getCount(tree, tree->left[index]);
+
+  for (IndexT parent = tree->parent[index]; parent != nullindex;
+       index = parent, parent = tree->parent[index])
+    if (tree->right[parent] == index)
+      position += getCount(tree, tree->left[parent]) + 1;
+
+  return position;
+}
+
+template <typename IndexT>
+size_t getOrderIndexSize(const BasicOrderIndex<IndexT> *tree)
+{
+  return getCount(tree, tree->root);
+}
+
+template <typename IndexT>
+static unsigned getPriority(BasicOrderIndex<IndexT> *tree)
+{
+  tree->seed ^= tree->seed << 13;
+  tree->seed ^= tree->seed >> 17;
+  tree->seed ^= tree->seed <<  5;
+
+  return tree->seed;
+}
+
+template <typename IndexT>
+static size_t getCount(const BasicOrderIndex<IndexT> *tree, IndexT vertex)
+{
+  return (vertex == nullindex) ? 0 : (size_t)tree->count[vertex];
+}
+
+template <typename IndexT>
+static void update(BasicOrderIndex<IndexT> *tree, IndexT vertex)
+{
+  IndexT left  = tree->left [vertex];
+  IndexT right = tree->right[vertex];
+
+  tree->count[vertex] = (IndexT)(getCount(tree, left) + getCount(tree, right) + 1);
+
+  if (left != nullindex)
+    tree->parent[left] = vertex;
+
+  if (right != nullindex)
+    tree->parent[right] = vertex;
+}
+
+template <typename IndexT>
+static void split(BasicOrderIndex<IndexT> *tree, IndexT vertex, size_t count, IndexT *first, IndexT *second)
+{
+  if (vertex == nullindex)
+    {
+      *first  = nullindex;
+      *second = nullindex;
+
+      return;
+    }
+
+  size_t leftCount = getCount(tree, tree->left[vertex]);
+
+  IndexT before = nullindex, after = nullindex;
+
+  if (leftCount < count)
+    {
+      split(tree, tree->right[vertex], count - leftCount - 1, &before, &after);
+
+      tree->right[vertex] = before;
+
+      *first  = vertex;
+      *second = after;
+    }
+  else
+    {
+      split(tree, tree->left[vertex], count, &before, &after);
+
+      tree->left[vertex] = after;
+
+      *first  = before;
+      *second = vertex;
+    }
+
+  update(tree, vertex);
+
+  if (*first != nullindex)
+    tree->parent[*first] = nullindex;
+
+  if (*second != nullindex)
+    tree->parent[*second] = nullindex;
+}
+
+template <typename IndexT>
+static IndexT merge(BasicOrderIndex<IndexT> *tree, IndexT first, IndexT second)
+{
+  if (first == nullindex)
+    return second;
+
+  if (second == nullindex)
+    return first;
+
+  if (tree->priority[first] > tree->priority[second])
+    {
+      tree->right[first] = merge(tree, tree->right[first], second);
+
+      update(tree, first);
+
+      return first;
+    }
+
+  tree->left[second] = merge(tree, first, tree->left[second]);
+
+  update(tree, second);
+
+  return second;
+}
+
+template <typename T, typename IndexT>
+static IndexT buildSubtree(BasicOrderIndex<IndexT> *tree, const BasicList<T, IndexT> *list, IndexT first,
+                          size_t count)
+{
+  size_t top = 0;
+
+  IndexT vertex = first;
+
+  for (size_t i = 0; i < count; ++i, vertex = list_next(list, vertex))
+    {
+      tree->left    [vertex] = nullindex;
+      tree->right   [vertex] = nullindex;
+      tree->priority[vertex] = getPriority(tree);
+
+      IndexT last = nullindex;
+
+      while (top && tree->priority[tree->stack[top - 1]] < tree->priority[vertex])
+        {
+          last = tree->stack[--top];
+
+          update(tree, last);
+        }
+
+      tree->left[vertex] = last;
+
+      if (top)
+        tree->right[tree->stack[top - 1]] = vertex;
+
+      tree->stack[top++] = vertex;
+    }
+
+  IndexT root = nullindex;
+
+  while (top)
+    {
+      root = tree->stack[--top];
+
+      update(tree, root);
+    }
+
+  return root;
+}
+
+template <typename IndexT>
+static void setRoot(BasicOrderIndex<IndexT> *tree, IndexT root)
+{
+  tree->root = root;
+
+  if (root != nullindex)
+    tree->parent[root] = nullindex;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef LISTQUEUE_H_
+#define LISTQUEUE_H_
+
+#include "list.h"
+
+/// Who may call enqueue functions of ListQueue
+enum ListQueueMode {
+  LIST_QUEUE_SPSC = 0, /// <- One producer thread
+  LIST_QUEUE_MPSC = 1, /// <- Many producer threads
+};
+
+/// Bounded FIFO queue between threads on preallocated Nodes of List
+/// @note Nodes from 1 to ::capacity are cells of ring, Node::elem is element of cell and
+/// Node::next is sequence of cell: position of enqueue which may write cell or
+/// position of dequeue plus one when cell is ready for read (Vyukov bounded queue)
+/// @note Cells are above List::untouched, so List stays empty and correct for validateList()
+/// @note There is only one consumer thread in both modes
+struct ListQueue {
+  List list;        /// <- List which Nodes are cells
+  size_t capacity;  /// <- Count of cells
+  int mode;         /// <- ListQueueMode
+
+  alignas(CACHE_LINE_SIZE) size_t tail; /// <- Position of next enqueue
+  unsigned enqueueEvents;               /// <- Futex word which is increased after enqueues
+  unsigned producersWaiting;            /// <- Count of producers which wait for free cell
+
+  alignas(CACHE_LINE_SIZE) size_t head; /// <- Position of next dequeue
+  unsigned dequeueEvents;               /// <- Futex word which is increased after dequeues
+  unsigned consumerWaiting;             /// <- Consumer waits for element
+  int isClosed;                         /// <- listQueue_close() was called
+};
+
+#define initListQueue(QUEUE, CAPACITY, ...)                                       \
+  do_initListQueue(QUEUE, CAPACITY, DEBUG_INFO(QUEUE) __VA_OPT__(,) __VA_ARGS__);
+
+/// Constructor for queue
+/// @param [in] queue ListQueue for initilizate
+/// @param [in] capacity Count of cells, it isn`t changed
+/// @param [in] info Information about call of this function
+/// @param [in/out] error Variable for save errors` code
+/// @param [in] mode ListQueueMode
+/// @note Use for init queue initListQueue()
+void do_initListQueue(ListQueue *queue, size_t capacity, DebugInfo info, int *error = nullptr,
+                      ListQueueMode mode = LIST_QUEUE_MPSC);
+
+/// Destructor for queue
+/// @param [in/out] queue ListQueue for destroy
+/// @param [in/out] error Variable for save errors` code
+/// @note No other thread may use queue during and after call, elements in queue are dropped
+void destroyListQueue(ListQueue *queue, int *error = nullptr);
+
+/// Add element to end of queue if there is free cell
+/// @param [in/out] queue ListQueue
+/// @param [in] element Element
+/// @return 1 if element was added, 0 if queue is full or closed
+/// @note It is lock-free
+int listQueue_tryEnqueue(ListQueue *queue, element_t element);
+
+/// Add element to end of queue, wait for free cell if queue is full
+/// @param [in/out] queue ListQueue
+/// @param [in] element Element
+/// @return 1 if element was added, 0 if queue was closed
+int listQueue_enqueue(ListQueue *queue, element_t element);
+
+/// Take element from start of queue if there is it
+/// @param [in/out] queue ListQueue
+/// @param [out] element Element
+/// @return 1 if element was taken, 0 if queue is empty
+/// @note It is lock-free, only consumer thread may call it
+int listQueue_tryDequeue(ListQueue *queue, element_t *element);
+
+/// Take element from start of queue, wait for element if queue is empty
+/// @param [in/out] queue ListQueue
+/// @param [out] element Element
+/// @return 1 if element was taken, 0 if queue is empty and closed
+/// @note Only consumer thread may call it
+int listQueue_dequeue(ListQueue *queue, element_t *element);
+
+/// Take ready elements from start of queue, wait for first of them if queue is empty
+/// @param [in/out] queue ListQueue
+/// @param [out] elements Array for elements
+/// @param [in] count Max count of elements
+/// @return Count of taken elements, 0 if queue is empty and closed
+/// @note Producers are woken once for all batch, only consumer thread may call it
+size_t listQueue_dequeueBatch(ListQueue *queue, element_t *elements, size_t count);
+
+/// Wake all waiting threads and reject new elements,
+/// consumer still gets elements which were added before
+/// @param [in/out] queue ListQueue
+void listQueue_close(ListQueue *queue);
+
+/// Count of elements in queue
+/// @param [in] queue ListQueue
+/// @return Count of elements, it is exact only if queue isn`t changed by other threads
+size_t listQueue_size(const ListQueue *queue);
+
+#define dumpListQueue(QUEUE, FILE)                                        \
+  do_dumpListQueue(QUEUE, FILE, __FILE__, __func__, __LINE__, "")
+
+#define dumpListQueueWithMessage(QUEUE, FILE, MESSAGE, ...)               \
+  do_dumpListQueue(QUEUE, FILE, __FILE__, __func__, __LINE__, MESSAGE __VA_OPT__(,) __VA_ARGS__)
+
+/// Make dump of queue: fields, List of cells and all cells from head to tail
+/// @param [in] queue ListQueue for dump
+/// @param [in] file File for dump
+/// @param [in] fileName Name of file where was call this function
+/// @param [in] functionName Name of function where was call this function
+/// @param [in] line Number of line  where was call this function
+/// @param [in] message Message(C-like format string) for title
+/// @param [in] ... arguments for message
+/// @note Cells are read without synchronization, so dump is exact only for stopped queue
+void do_dumpListQueue(
+                      const ListQueue *queue,
+                      FILE *file,
+                      const char *fileName,
+                      const char *functionName,
+                      int line,
+                      const char *message,
+                      ...
+                      );
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef LISTSLOTS_H_
+#define LISTSLOTS_H_
+
+#include "list.h"
+
+/// Lock-free stack of indexes of Nodes (Treiber stack)
+/// @note Top is packed with tag which is increased by each change of top,
+/// so pop which read top before pop and push of the same index fails (no ABA)
+struct SlotStack {
+  unsigned long long top; /// <- Tag in high 32 bits and index of top slot in low 32 bits
+  index_t **chunks;       /// <- Chunks of STORAGE_CHUNK_SIZE links, link of slot is slot below it
+  size_t chunkCount;      /// <- Count of pointers in chunks, enough for any index_t
+  size_t count;           /// <- Count of slots in stack, it is increased before push and decreased after pop
+};
+
+/// Constructor for SlotStack
+/// @return Pointer to empty SlotStack or nullptr if was error
+SlotStack *createSlotStack();
+
+/// Destructor for SlotStack
+/// @param [in] stack SlotStack from createSlotStack() or nullptr
+/// @note No other thread may use stack during call
+void destroySlotStack(SlotStack *stack);
+
+/// Push slots to stack by one change of top, first of them becomes top
+/// @param [in/out] stack SlotStack
+/// @param [in] indexes Indexes of slots
+/// @param [in] count Count of slots
+/// @return 0 if slots were pushed else -1
+/// @note It is lock-free and may be called from any thread
+int pushSlots(SlotStack *stack, const index_t *indexes, size_t count);
+
+/// Push one slot to stack
+/// @see pushSlots()
+int pushSlot(SlotStack *stack, index_t index);
+
+/// Pop top slot from stack
+/// @param [in/out] stack SlotStack
+/// @return Index of slot or nullindex if stack is empty
+/// @note It is lock-free and may be called from any thread
+index_t popSlot(SlotStack *stack);
+
+/// Count of slots in stack
+/// @param [in] stack SlotStack
+/// @return Count of slots, it is exact only if stack isn`t changed by other threads
+size_t getSlotCount(const SlotStack *stack);
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef LISTSORT_H_
+#define LISTSORT_H_
+
+#include "list.h"
+
+/// Stable merge sort of main sequence of list by relink of its Nodes
+/// @param [in/out] list BasicList
+/// @param [in] compare Comparator of elements
+/// @param [in] threadCount Count of threads, 1 for sort in calling thread
+/// @return 0 if list was sorted else -1
+/// @note Elements stay in their Nodes, only links of elements and Node 0 are written,
+/// hashes aren`t updated
+/// @note Needs memory only for heads of threadCount chains
+template <typename T, typename IndexT>
+int sortLinks(BasicList<T, IndexT> *list, std::type_identity_t<basic_element_compare_t<T>> compare,
+              size_t threadCount);
+
+#include "listsortimpl.h"
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef LISTSORTIMPL_H_
+#define LISTSORTIMPL_H_
+
+#include <stdlib.h>
+#include "listsort.h"
+#include "liststorage.h"
+#include "parallel.h"
+
+/// Arguments of tasks of sortLinks()
+template <typename T, typename IndexT>
+struct SortContext {
+  BasicList<T, IndexT>       *list;       /// <- Sorted list
+  IndexT                     *heads;      /// <- Heads of chains, chain ends with nullindex after sort
+  const size_t               *counts;     /// <- Count of Nodes in each chain before sort
+  size_t                      chainCount; /// <- Count of chains
+  basic_element_compare_t<T>  compare;    /// <- Comparator of elements
+};
+
+/// Sort count Nodes from *head, *head is set to Node after them
+/// @return Head of sorted chain which ends with nullindex
+template <typename T, typename IndexT>
+static IndexT sortChain(BasicList<T, IndexT> *list, IndexT *head, size_t count,
+                        basic_element_compare_t<T> compare);
+
+/// Stable merge of two sorted chains which end with nullindex
+/// @return Head of merged chain
+template <typename T, typename IndexT>
+static IndexT mergeChains(BasicList<T, IndexT> *list, IndexT first, IndexT second,
+                          basic_element_compare_t<T> compare);
+
+/// Task which sorts one chain
+template <typename T, typename IndexT>
+static void sortRun(void *context, size_t taskIndex);
+
+/// Task which merges pair of chains to first of them
+template <typename T, typename IndexT>
+static void mergeRuns(void *context, size_t taskIndex);
+
+template <typename T, typename IndexT>
+int sortLinks(BasicList<T, IndexT> *list, std::type_identity_t<basic_element_compare_t<T>> compare,
+              size_t threadCount)
+{
+  if (!list || !compare)
+    return -1;
+
+  if (list->size < 2)
+    return 0;
+
+  if (threadCount > list->size / PARALLEL_CHUNK_SIZE)
+    threadCount = list->size / PARALLEL_CHUNK_SIZE;
+
+  IndexT head = list_head(list);
+
+  if (threadCount <= 1)
+    head = sortChain(list, &head, list->size, compare);
+  else
+    {
+      IndexT *heads  = (IndexT *)calloc(threadCount, sizeof(IndexT));
+      size_t *counts = (size_t *)calloc(threadCount, sizeof(size_t));
+
+      if (!heads || !counts)
+        {
+          free(heads);
+          free(counts);
+
+          return -1;
+        }
+
+      for (size_t i = 0; i < threadCount; ++i)
+        {
+          heads [i] = head;
+          counts[i] = (i + 1)*list->size / threadCount - i*list->size / threadCount;
+
+          for (size_t j = 0; j < counts[i]; ++j)
+            head = list_next(list, head);
+        }
+
+      SortContext<T, IndexT> context = {
+        .list       = list,
+        .heads      = heads,
+        .counts     = counts,
+        .chainCount = threadCount,
+        .compare    = compare
+      };
+
+      int error = runParallel(sortRun<T, IndexT>, &context, threadCount, threadCount);
+
+      while (!error && context.chainCount > 1)
+        {
+          size_t pairCount = context.chainCount / 2;
+
+          error = runParallel(mergeRuns<T, IndexT>, &context, pairCount, threadCount);
+
+          for (size_t i = 0; i < (context.chainCount + 1) / 2; ++i)
+            heads[i] = heads[2*i];
+
+          context.chainCount = (context.chainCount + 1) / 2;
+        }
+
+      head = heads[0];
+
+      free(heads);
+      free(counts);
+
+      if (error)
+        return -1;
+    }
+
+  set_head(list, head);
+
+  IndexT prev = nullindex;
+
+  for (IndexT curr = head; curr != nullindex; prev = curr, curr = list_next(list, curr))
+    writePrev(list, curr, prev);
+
+  set_tail(list, prev);
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static IndexT sortChain(BasicList<T, IndexT> *list, IndexT *head, size_t count,
+                        basic_element_compare_t<T> compare)
+{
+  if (!count)
+    return nullindex;
+
+  if (count == 1)
+    {
+      IndexT node = *head;
+
+      *head = list_next(list, node);
+
+      writeNext(list, node, nullindex);
+
+      return node;
+    }
+
+  IndexT first  = sortChain(list, head, count / 2,         compare);
+  IndexT second = sortChain(list, head, count - count / 2, compare);
+
+  return mergeChains(list, first, second, compare);
+}
+
+template <typename T, typename IndexT>
+static IndexT mergeChains(BasicList<T, IndexT> *list, IndexT first, IndexT second,
+                          basic_element_compare_t<T> compare)
+{
+  if (first == nullindex)
+    return second;
+
+  if (second == nullindex)
+    return first;
+
+  IndexT head = nullindex;
+
+  if (compare(list_element(list, second), list_element(list, first)) < 0)
+    {
+      head   = second;
+      second = list_next(list, second);
+    }
+  else
+    {
+      head  = first;
+      first = list_next(list, first);
+    }
+
+  IndexT tail = head;
+
+  while (first != nullindex && second != nullindex)
+    {
+      if (compare(list_element(list, second), list_element(list, first)) < 0)
+        {
+          writeNext(list, tail, second);
+
+          tail   = second;
+          second = list_next(list, second);
+        }
+      else
+        {
+          writeNext(list, tail, first);
+
+          tail  = first;
+          first = list_next(list, first);
+        }
+    }
+
+  writeNext(list, tail, (first != nullindex) ? first : second);
+
+  return head;
+}
+
+template <typename T, typename IndexT>
+static void sortRun(void *context, size_t taskIndex)
+{
+  SortContext<T, IndexT> *ctx = (SortContext<T, IndexT> *)context;
+
+  IndexT head = ctx->heads[taskIndex];
+
+  ctx->heads[taskIndex] = sortChain(ctx->list, &head, ctx->counts[taskIndex], ctx->compare);
+}
+
+template <typename T, typename IndexT>
+static void mergeRuns(void *context, size_t taskIndex)
+{
+  SortContext<T, IndexT> *ctx = (SortContext<T, IndexT> *)context;
+
+  ctx->heads[2*taskIndex] = mergeChains(ctx->list, ctx->heads[2*taskIndex], ctx->heads[2*taskIndex + 1],
+                                        ctx->compare);
+}
+
+#endif
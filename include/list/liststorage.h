@@ -0,0 +1,92 @@
+#ifndef LISTSTORAGE_H_
+#define LISTSTORAGE_H_
+
+#include "list.h"
+
+/// Read Node from memory of list
+/// @param [in] list List
+/// @param [in] index Index of Node
+/// @return Node
+template <typename T, typename IndexT>
+BasicNode<T, IndexT> readNode(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index);
+
+/// Write Node to memory of list
+/// @param [in/out] list List
+/// @param [in] index Index of Node
+/// @param [in] node Node
+/// @note Doesn`t update hashes
+template <typename T, typename IndexT>
+void writeNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+               std::type_identity_t<BasicNode<T, IndexT>> node);
+
+/// Write Node::next to memory of list
+/// @param [in/out] list List
+/// @param [in] index Index of Node
+/// @param [in] next Index of next Node
+/// @note Doesn`t update hashes
+template <typename T, typename IndexT>
+inline void writeNext(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                      std::type_identity_t<IndexT> next)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    list->nexts[index] = next;
+  else if (list->storage == LIST_STORAGE_CHUNKED)
+    list_chunkNode(list, index)->next = next;
+  else
+    list->data[index].next = next;
+}
+
+/// Write Node::prev to memory of list
+/// @param [in/out] list List
+/// @param [in] index Index of Node
+/// @param [in] prev Index of previous Node
+/// @note Doesn`t update hashes
+template <typename T, typename IndexT>
+inline void writePrev(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+                      std::type_identity_t<IndexT> prev)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    list->prevs[index] = prev;
+  else if (list->storage == LIST_STORAGE_CHUNKED)
+    list_chunkNode(list, index)->prev = prev;
+  else
+    list->data[index].prev = prev;
+}
+
+/// Alloc memory for capacity Nodes in layout List::storage
+/// @param [in/out] list List
+/// @param [in] capacity Count of Nodes
+/// @return 0 if memory was allocated else -1
+/// @note Old memory of list isn`t freed
+template <typename T, typename IndexT>
+int allocStorage(BasicList<T, IndexT> *list, size_t capacity);
+
+/// Realloc memory of list with saving Nodes
+/// @param [in/out] list List
+/// @param [in] capacity New count of Nodes
+/// @return 0 if memory was reallocated else -1
+template <typename T, typename IndexT>
+int reallocStorage(BasicList<T, IndexT> *list, size_t capacity);
+
+/// Free memory of list
+/// @param [in/out] list List
+template <typename T, typename IndexT>
+void freeStorage(BasicList<T, IndexT> *list);
+
+/// Check that memory of list is allocated
+/// @param [in] list List
+/// @return 1 if all arrays of layout are allocated else 0
+template <typename T, typename IndexT>
+int hasStorage(const BasicList<T, IndexT> *list);
+
+/// Check canaries of memory of list
+/// @param [in] list List
+/// @param [in] level Level of validation, below LIST_VALIDATE_HASH only first and last chunks
+/// of LIST_STORAGE_CHUNKED are checked, so check is O(1)
+/// @return Errors` code
+template <typename T, typename IndexT>
+unsigned validateStorage(const BasicList<T, IndexT> *list, ListValidationLevel level);
+
+#include "liststorageimpl.h"
+
+#endif
@@ -0,0 +1,489 @@
+#ifndef LISTSTORAGEIMPL_H_
+#define LISTSTORAGEIMPL_H_
+
+#include "list.h"
+#include "liststorage.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "systemlike.h"
+
+#ifdef NEED_CANARY_
+
+const size_t ARRAY_CANARY_SIZE = sizeof(canary_t);
+
+#else
+
+const size_t ARRAY_CANARY_SIZE = 0;
+
+#endif
+
+/// Offset of array from start of its block, left canary is right before array
+static inline size_t getArrayOffset(size_t align);
+
+/// Realloc array with canaries around it from oldCount elements to count, array is aligned by align
+static inline void *reallocArray(void *array, size_t oldCount, size_t count, size_t size, size_t align);
+
+/// Realloc array which is mapped before or after realloc
+static inline void *reallocMappedArray(void *array, size_t oldCount, size_t count, size_t size, size_t align);
+
+/// Free array with canaries around it
+static inline void freeArray(void *array, size_t count, size_t size, size_t align);
+
+/// reallocArray() for array of Elem
+template <typename Elem>
+static Elem *reallocArrayOf(Elem *array, size_t oldCount, size_t count);
+
+/// freeArray() for array of Elem
+template <typename Elem>
+static void freeArrayOf(Elem *array, size_t count);
+
+/// Check that array of count elements is mapped instead of allocated in heap
+static inline int isMappedArray(size_t count, size_t size);
+
+/// Count of chunks of LIST_STORAGE_CHUNKED which contain capacity Nodes
+static inline size_t getChunkCount(size_t capacity);
+
+/// Realloc arrays of LIST_STORAGE_SOA, on error all of them stay with old capacity
+/// @note Shrink copies Nodes to new arrays, so no array is cut before all new ones are allocated
+template <typename T, typename IndexT>
+static int reallocArrays(BasicList<T, IndexT> *list, size_t capacity);
+
+/// Alloc or free chunks of list for capacity, old chunks stay at their addresses
+/// @note Shrink can`t fail, old larger array of pointers to chunks is kept if it isn`t reallocated
+template <typename T, typename IndexT>
+static int reallocChunks(BasicList<T, IndexT> *list, size_t capacity);
+
+/// Copy Nodes from mapped file to own array for capacity and unmap file
+template <typename T, typename IndexT>
+static int detachFile(BasicList<T, IndexT> *list, size_t capacity);
+
+/// Check canaries around array
+static inline unsigned validateArray(const void *array, size_t count, size_t size);
+
+template <typename T, typename IndexT>
+BasicNode<T, IndexT> readNode(const BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return BasicNode<T, IndexT> {
+      .elem = list->elems[index],
+      .next = list->nexts[index],
+      .prev = list->prevs[index]
+    };
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return *list_chunkNode(list, index);
+
+  return list->data[index];
+}
+
+template <typename T, typename IndexT>
+void writeNode(BasicList<T, IndexT> *list, std::type_identity_t<IndexT> index,
+               std::type_identity_t<BasicNode<T, IndexT>> node)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    {
+      list->elems[index] = node.elem;
+      list->nexts[index] = node.next;
+      list->prevs[index] = node.prev;
+
+      return;
+    }
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    {
+      *list_chunkNode(list, index) = node;
+
+      return;
+    }
+
+  list->data[index] = node;
+}
+
+template <typename T, typename IndexT>
+int allocStorage(BasicList<T, IndexT> *list, size_t capacity)
+{
+  list->data   = nullptr;
+  list->elems  = nullptr;
+  list->nexts  = nullptr;
+  list->prevs  = nullptr;
+  list->chunks = nullptr;
+
+  list->file     = nullptr;
+  list->fileSize = 0;
+
+  return reallocStorage(list, capacity);
+}
+
+template <typename T, typename IndexT>
+int reallocStorage(BasicList<T, IndexT> *list, size_t capacity)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return reallocArrays(list, capacity);
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return reallocChunks(list, capacity);
+
+  if (list->file)
+    return detachFile(list, capacity);
+
+  BasicNode<T, IndexT> *data = reallocArrayOf(list->data, list->capacity, capacity);
+
+  if (!data)
+    return -1;
+
+  list->data = data;
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+void freeStorage(BasicList<T, IndexT> *list)
+{
+  if (list->file)
+    {
+      mapFree(list->file, list->fileSize);
+
+      list->data = nullptr;
+    }
+
+  list->file     = nullptr;
+  list->fileSize = 0;
+
+  freeArrayOf(list->data,  list->capacity);
+  freeArrayOf(list->elems, list->capacity);
+  freeArrayOf(list->nexts, list->capacity);
+  freeArrayOf(list->prevs, list->capacity);
+
+  if (list->chunks)
+    reallocChunks(list, 0);
+
+  free(list->chunks);
+
+  list->data   = nullptr;
+  list->elems  = nullptr;
+  list->nexts  = nullptr;
+  list->prevs  = nullptr;
+  list->chunks = nullptr;
+}
+
+template <typename T, typename IndexT>
+int hasStorage(const BasicList<T, IndexT> *list)
+{
+  if (list->storage == LIST_STORAGE_SOA)
+    return isPointerCorrect(list->elems) &&
+           isPointerCorrect(list->nexts) &&
+           isPointerCorrect(list->prevs);
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    return isPointerCorrect(list->chunks);
+
+  return isPointerCorrect(list->data);
+}
+
+template <typename T, typename IndexT>
+unsigned validateStorage(const BasicList<T, IndexT> *list, ListValidationLevel level)
+{
+  if (!list->capacity || !hasStorage(list))
+    return 0;
+
+  if (list->storage == LIST_STORAGE_SOA)
+    return validateArray(list->elems, list->capacity, sizeof(T))      |
+           validateArray(list->nexts, list->capacity, sizeof(IndexT)) |
+           validateArray(list->prevs, list->capacity, sizeof(IndexT));
+
+  if (list->storage == LIST_STORAGE_CHUNKED)
+    {
+      unsigned error = 0;
+
+      size_t chunkCount = getChunkCount(list->capacity);
+
+      if (level < LIST_VALIDATE_HASH)
+        return validateArray(list->chunks[0],              STORAGE_CHUNK_SIZE, sizeof(BasicNode<T, IndexT>)) |
+               validateArray(list->chunks[chunkCount - 1], STORAGE_CHUNK_SIZE, sizeof(BasicNode<T, IndexT>));
+
+      for (size_t i = 0; i < chunkCount; ++i)
+        error |= validateArray(list->chunks[i], STORAGE_CHUNK_SIZE, sizeof(BasicNode<T, IndexT>));
+
+      return error;
+    }
+
+  return validateArray(list->data, list->capacity, sizeof(BasicNode<T, IndexT>));
+}
+
+static inline void *reallocArray(void *array, size_t oldCount, size_t count, size_t size, size_t align)
+{
+  if ((array && isMappedArray(oldCount, size)) || isMappedArray(count, size))
+    return reallocMappedArray(array, oldCount, count, size, align);
+
+  size_t offset = getArrayOffset(align);
+
+  char *block = array ? (char *)array - offset : nullptr;
+
+  char *newBlock = (char *)recalloc(block, 1, offset + count*size + ARRAY_CANARY_SIZE);
+
+  if (!newBlock)
+    return nullptr;
+
+#ifdef NEED_CANARY_
+
+  *(canary_t *)(newBlock + offset - ARRAY_CANARY_SIZE) = LEFT_CANARY;
+
+  *(canary_t *)(newBlock + offset + count*size) = RIGHT_CANARY;
+
+#endif
+
+  return newBlock + offset;
+}
+
+static inline void *reallocMappedArray(void *array, size_t oldCount, size_t count, size_t size, size_t align)
+{
+  size_t offset = getArrayOffset(align);
+
+  char *block    = array ? (char *)array - offset : nullptr;
+  size_t oldSize = array ? offset + oldCount*size + ARRAY_CANARY_SIZE : 0;
+  size_t newSize = offset + count*size + ARRAY_CANARY_SIZE;
+
+  int wasMapped = array && isMappedArray(oldCount, size);
+  int isMapped  = isMappedArray(count, size);
+
+  char *newBlock = nullptr;
+
+  if (wasMapped && isMapped)
+    newBlock = (char *)mapRealloc(block, oldSize, newSize);
+  else
+    {
+      newBlock = isMapped ? (char *)mapRealloc(nullptr, 0, newSize) : (char *)calloc(1, newSize);
+
+      if (newBlock && block)
+        memcpy(newBlock, block, (oldSize < newSize) ? oldSize : newSize);
+
+      if (newBlock && wasMapped)
+        mapFree(block, oldSize);
+      else if (newBlock)
+        free(block);
+    }
+
+  if (!newBlock)
+    return nullptr;
+
+#ifdef NEED_CANARY_
+
+  *(canary_t *)(newBlock + offset - ARRAY_CANARY_SIZE) = LEFT_CANARY;
+
+  *(canary_t *)(newBlock + newSize - ARRAY_CANARY_SIZE) = RIGHT_CANARY;
+
+#endif
+
+  return newBlock + offset;
+}
+
+static inline void freeArray(void *array, size_t count, size_t size, size_t align)
+{
+  if (!array)
+    return;
+
+  size_t offset = getArrayOffset(align);
+
+  if (isMappedArray(count, size))
+    {
+      mapFree((char *)array - offset, offset + count*size + ARRAY_CANARY_SIZE);
+
+      return;
+    }
+
+  free((char *)array - offset);
+}
+
+static inline size_t getArrayOffset(size_t align)
+{
+  return (ARRAY_CANARY_SIZE + align - 1) / align * align;
+}
+
+template <typename Elem>
+static Elem *reallocArrayOf(Elem *array, size_t oldCount, size_t count)
+{
+  static_assert(alignof(Elem) <= alignof(max_align_t), "Blocks of arrays are aligned by malloc()");
+
+  return (Elem *)reallocArray(array, oldCount, count, sizeof(Elem), alignof(Elem));
+}
+
+template <typename Elem>
+static void freeArrayOf(Elem *array, size_t count)
+{
+  freeArray(array, count, sizeof(Elem), alignof(Elem));
+}
+
+static inline int isMappedArray(size_t count, size_t size)
+{
+  return count*size >= MAPPED_STORAGE_MIN_SIZE;
+}
+
+static inline size_t getChunkCount(size_t capacity)
+{
+  return (capacity + STORAGE_CHUNK_SIZE - 1) / STORAGE_CHUNK_SIZE;
+}
+
+template <typename T, typename IndexT>
+static int reallocArrays(BasicList<T, IndexT> *list, size_t capacity)
+{
+  const size_t ARRAY_COUNT = 3;
+
+  void  *arrays[ARRAY_COUNT] = {list->elems, list->nexts, list->prevs};
+  size_t sizes [ARRAY_COUNT] = {sizeof(T),  sizeof(IndexT),  sizeof(IndexT)};
+  size_t aligns[ARRAY_COUNT] = {alignof(T), alignof(IndexT), alignof(IndexT)};
+
+  if (capacity < list->capacity)
+    {
+      void *newArrays[ARRAY_COUNT] = {};
+
+      for (size_t i = 0; i < ARRAY_COUNT; ++i)
+        {
+          newArrays[i] = reallocArray(nullptr, 0, capacity, sizes[i], aligns[i]);
+
+          if (!newArrays[i])
+            {
+              for (size_t j = 0; j < i; ++j)
+                freeArray(newArrays[j], capacity, sizes[j], aligns[j]);
+
+              return -1;
+            }
+        }
+
+      for (size_t i = 0; i < ARRAY_COUNT; ++i)
+        {
+          if (arrays[i])
+            memcpy(newArrays[i], arrays[i], capacity*sizes[i]);
+
+          freeArray(arrays[i], list->capacity, sizes[i], aligns[i]);
+
+          arrays[i] = newArrays[i];
+        }
+    }
+  else
+    for (size_t i = 0; i < ARRAY_COUNT; ++i)
+      {
+        void *array = reallocArray(arrays[i], list->capacity, capacity, sizes[i], aligns[i]);
+
+        if (!array)
+          {
+            for (size_t j = 0; j < i; ++j)
+              {
+                void *oldArray = reallocArray(arrays[j], capacity, list->capacity, sizes[j], aligns[j]);
+
+                if (oldArray)
+                  arrays[j] = oldArray;
+              }
+
+            list->elems = (T *)arrays[0];
+            list->nexts = (IndexT *)arrays[1];
+            list->prevs = (IndexT *)arrays[2];
+
+            return -1;
+          }
+
+        arrays[i] = array;
+      }
+
+  list->elems = (T *)arrays[0];
+  list->nexts = (IndexT *)arrays[1];
+  list->prevs = (IndexT *)arrays[2];
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int reallocChunks(BasicList<T, IndexT> *list, size_t capacity)
+{
+  size_t oldCount = list->chunks ? getChunkCount(list->capacity) : 0;
+  size_t newCount = getChunkCount(capacity);
+
+  for (size_t i = newCount; i < oldCount; ++i)
+    {
+      freeArrayOf(list->chunks[i], STORAGE_CHUNK_SIZE);
+
+      list->chunks[i] = nullptr;
+    }
+
+  if (!newCount)
+    return 0;
+
+  BasicNode<T, IndexT> **chunks =
+    (BasicNode<T, IndexT> **)recalloc(list->chunks, newCount, sizeof(BasicNode<T, IndexT> *));
+
+  if (!chunks)
+    return (newCount < oldCount) ? 0 : -1;
+
+  list->chunks = chunks;
+
+  for (size_t i = oldCount; i < newCount; ++i)
+    {
+      chunks[i] = reallocArrayOf<BasicNode<T, IndexT>>(nullptr, 0, STORAGE_CHUNK_SIZE);
+
+      if (!chunks[i])
+        {
+          for (size_t j = oldCount; j < i; ++j)
+            {
+              freeArrayOf(chunks[j], STORAGE_CHUNK_SIZE);
+
+              chunks[j] = nullptr;
+            }
+
+          return -1;
+        }
+    }
+
+  return 0;
+}
+
+template <typename T, typename IndexT>
+static int detachFile(BasicList<T, IndexT> *list, size_t capacity)
+{
+  BasicNode<T, IndexT> *data = reallocArrayOf<BasicNode<T, IndexT>>(nullptr, 0, capacity);
+
+  if (!data)
+    return -1;
+
+  size_t count = (capacity < list->capacity) ? capacity : list->capacity;
+
+  memcpy(data, list->data, count*sizeof(BasicNode<T, IndexT>));
+
+  mapFree(list->file, list->fileSize);
+
+  list->data     = data;
+  list->file     = nullptr;
+  list->fileSize = 0;
+
+  return 0;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+static inline unsigned validateArray(const void *array, size_t count, size_t size)
+{
+  unsigned error = 0;
+
+#ifdef NEED_CANARY_
+
+  if (!checkLeftCanary((void *)array))
+    error |= LIST_LEFT_DATA_CANARY_DIED;
+
+  if (!checkRightCanary((char *)array + count*size))
+    error |= LIST_RIGHT_DATA_CANARY_DIED;
+
+#else
+
+  (void)array;
+  (void)count;
+  (void)size;
+
+#endif
+
+  return error;
+}
+
+#pragma GCC diagnostic pop
+
+#endif
@@ -23,11 +23,15 @@ unsigned enum LogLevel {
   VALUE   = (0x01 << 4),
 };
 
-/// Getter for LOG_FILE
+/// Lock LOG_FILE for writes of calling thread
 /// @return LOG_FILE or NULL if fail to open file
 /// @note If log file bigger than 1GB close it and open new file and save descriptor in LOG_FILE\n
 /// If was error in open file set LOG_LEVEL to 0
-FILE *getLogFile();
+/// @note File isn`t closed until unlockLogFile(), lock is recursive
+FILE *lockLogFile();
+
+/// Unlock LOG_FILE after lockLogFile()
+void unlockLogFile();
 
 #ifndef RELEASE_BUILD_
 
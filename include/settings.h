@@ -1,10 +1,18 @@
 #ifndef SETTINGS_H_
 #define SETTINGS_H_
 
+#include <stddef.h>
+
 #define NEED_CANARY_
 #define NEED_HASH_
 #define DEBUG_BUILD_
 
+/// Max level of validateList(), levels which set in runtime are clamped to it
+#define MAX_VALIDATION_LEVEL_     LIST_VALIDATE_DEEP
+
+/// Level of validateList() which set to List in initList(), it must be O(1) to keep list functions O(1)
+#define DEFAULT_VALIDATION_LEVEL_ LIST_VALIDATE_FAST
+
 /// Typedef for list.h
 typedef int element_t;
 
@@ -12,4 +20,46 @@ typedef int index_t;
 
 const index_t nullindex = 0;
 
+/// HashKind which set to List in initList()
+#define DEFAULT_HASH_KIND_        HASH_CRC32C
+
+/// Count of Nodes in one leaf of List data hash tree
+const size_t HASH_BLOCK_SIZE = 64;
+
+/// Min size of one array of List data in bytes which is mapped and grown without copy
+const size_t MAPPED_STORAGE_MIN_SIZE = 1 << 21;
+
+/// Log2 of count of Nodes in one chunk of LIST_STORAGE_CHUNKED
+const size_t STORAGE_CHUNK_SHIFT = 12;
+
+/// Count of Nodes in one chunk of LIST_STORAGE_CHUNKED
+const size_t STORAGE_CHUNK_SIZE = (size_t)1 << STORAGE_CHUNK_SHIFT;
+
+/// Size of buffer of list_writeToFd() and list_readFromFd() in bytes
+const size_t STREAM_BUFFER_SIZE = 1 << 20;
+
+/// Count of Nodes which ConcurrentList reserves at once for its pool of free slots
+const size_t SLOT_BATCH_SIZE = 64;
+
+/// Size of cache line in bytes, fields of ListQueue which are written by different threads are on different lines
+const size_t CACHE_LINE_SIZE = 64;
+
+/// Min size of List which list_sort() sorts on all CPU cores
+const size_t PARALLEL_SORT_MIN_SIZE = 1 << 16;
+
+/// Min size of List which list_restoreLinearity() ranks on all CPU cores
+const size_t PARALLEL_RANKING_MIN_SIZE = 1 << 16;
+
+/// Distance between indexes of Nodes which split List to sublists for parallel ranking
+const size_t RANKING_RULER_SPACING = 1 << 10;
+
+/// Min count of touched Nodes of List which deep validateList() scans on all CPU cores
+const size_t PARALLEL_VALIDATION_MIN_SIZE = 1 << 20;
+
+/// Count of elements in one task of list_parallelForEach() and list_parallelTransform()
+const size_t PARALLEL_CHUNK_SIZE = 1 << 12;
+
+/// Count of elements which list_defragFor() checks between reads of clock
+const size_t DEFRAG_CLOCK_PERIOD = 256;
+
 #endif
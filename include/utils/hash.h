@@ -7,6 +7,69 @@ typedef unsigned hash_t;
 
 const hash_t nullhash = 0;
 
+/// Hash function which hashes bytes from dataStart to dataEnd
+typedef hash_t (*hash_function_t)(const void *dataStart, const void *dataEnd);
+
+/// Kinds of hash functions
+/// @note Result of each kind doesn`t depend on CPU, only speed does
+enum HashKind {
+  HASH_BYTE   = 0, /// <- Byte-at-a-time shift-add hash, getHash()
+  HASH_WORD   = 1, /// <- Word-at-a-time multiply hash, getWordHash()
+  HASH_SIMD   = 2, /// <- Eight 32-bit lanes multiply hash, getSimdHash(), blocks of small cells are hashed lane per cell
+  HASH_CRC32C = 3, /// <- CRC32C, getCrc32cHash()
+};
+
+/// Count of hash kinds
+const int HASH_KIND_COUNT = 4;
+
 hash_t getHash(const void *dataStart, const void *dataEnd);
 
+/// Word-at-a-time hash
+/// @param [in] dataStart Pointer to start of data
+/// @param [in] dataEnd Pointer to end of data
+/// @return Hash of data
+hash_t getWordHash(const void *dataStart, const void *dataEnd);
+
+/// Hash with eight independent lanes
+/// @param [in] dataStart Pointer to start of data
+/// @param [in] dataEnd Pointer to end of data
+/// @return Hash of data
+/// @note Uses AVX2 if CPU supports it
+hash_t getSimdHash(const void *dataStart, const void *dataEnd);
+
+/// CRC32C (Castagnoli) of data
+/// @param [in] dataStart Pointer to start of data
+/// @param [in] dataEnd Pointer to end of data
+/// @return Hash of data
+/// @note Uses SSE4.2 crc32 instruction if CPU supports it
+hash_t getCrc32cHash(const void *dataStart, const void *dataEnd);
+
+/// Get hash function by its kind
+/// @param [in] kind Kind of hash function
+/// @return Hash function, getHash() for unknown kind
+/// @note Each returned function checks CPU once, on its own first call, and then uses the fastest supported instructions
+hash_function_t getHashFunction(HashKind kind);
+
+/// Get hash of one cell of array which may be combined with others
+/// @param [in] cellStart Pointer to start of cell
+/// @param [in] cellEnd Pointer to end of cell
+/// @param [in] cellIndex Index of cell in array
+/// @param [in] hashFunction Hash function for bytes of cell
+/// @return Hash of cell
+/// @note Hash of array is sum of hashes of its cells, so change of one cell
+/// may be applied by subtract old cell hash and add new one
+hash_t getCellHash(const void *cellStart, const void *cellEnd, size_t cellIndex,
+                   hash_function_t hashFunction = getHash);
+
+/// Get sum of getCellHash() of consecutive cells of array
+/// @param [in] cells Pointer to first cell
+/// @param [in] cellSize Size of one cell in bytes
+/// @param [in] cellCount Count of cells
+/// @param [in] firstIndex Index of first cell in array
+/// @param [in] kind Kind of hash function for bytes of cells
+/// @return Sum of hashes of cells
+/// @note With AVX2 HASH_SIMD hashes eight cells at once, one cell per lane,
+/// if size of cell is multiple of 4 and less than stripe of getSimdHash()
+hash_t getCellsHash(const void *cells, size_t cellSize, size_t cellCount, size_t firstIndex, HashKind kind);
+
 #endif
@@ -0,0 +1,41 @@
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include <stddef.h>
+
+/// Function which does one task of runParallel()
+/// @param [in/out] argument Common argument of all tasks
+/// @param [in] taskIndex Index of task from 0 to count of tasks
+typedef void (*parallel_task_t)(void *argument, size_t taskIndex);
+
+/// Get count of online CPU cores
+/// @return Count of cores, at least 1
+size_t getCoreCount();
+
+/// Set count of threads which is used by runParallel() and list functions instead of count of cores
+/// @param [in] threadCount Count of threads, 0 for getCoreCount()
+void setParallelThreadCount(size_t threadCount);
+
+/// Get count of threads which is used by runParallel() when it isn`t given
+/// @return Count from setParallelThreadCount() or getCoreCount()
+size_t getParallelThreadCount();
+
+/// Get count of jobs which were shared between several threads
+/// @return Count of calls of runParallel() which didn`t do all tasks on calling thread
+size_t getParallelJobCount();
+
+/// Run tasks on several threads and wait until all are done
+/// @param [in] task Function of task
+/// @param [in/out] argument Argument for each call of task
+/// @param [in] taskCount Count of tasks
+/// @param [in] threadCount Max count of threads, 0 for getParallelThreadCount()
+/// @return 0 if all tasks were done else -1
+/// @note Calling thread does tasks too, if threads can`t be created it does all tasks
+/// @note Threads are created by first call and wait for tasks of next calls, call from task
+/// or during call from other thread does all tasks on calling thread
+/// @note Each thread gets range of tasks and does them in order, thread without tasks
+/// steals second half of range of other thread, so tasks of different cost are balanced
+/// @note Count of tasks must be less than 2^32
+int runParallel(parallel_task_t task, void *argument, size_t taskCount, size_t threadCount = 0);
+
+#endif
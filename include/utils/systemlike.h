@@ -10,6 +10,55 @@
 /// @return Pointer to allocate memory or NULL if was error in function
 void *recalloc(void *pointer, size_t elements, size_t elementSize);
 
+/// Realloc anonymous mapped memory, growth moves pages without copy
+/// @param [in] pointer Pointer to memory which was get from mapRealloc or nullptr
+/// @param [in] oldSize Size of memory by pointer
+/// @param [in] newSize New size of memory
+/// @return Pointer to mapped memory or NULL if was error in function
+/// @note New pages are zeroed by system on first touch, tail of last old page isn`t cleared
+void *mapRealloc(void *pointer, size_t oldSize, size_t newSize);
+
+/// Free memory which was get from mapRealloc
+/// @param [in] pointer Pointer to mapped memory
+/// @param [in] size Size of memory by pointer
+void mapFree(void *pointer, size_t size);
+
+/// Write all bytes to file descriptor, repeat write after partial writes
+/// @param [in] fileDescriptor File descriptor
+/// @param [in] buffer Bytes
+/// @param [in] size Count of bytes
+/// @return 0 if all bytes were written else -1
+int writeFull(int fileDescriptor, const void *buffer, size_t size);
+
+/// Sleep while value by address is equal to expected value (futex wait)
+/// @param [in] address Address of futex word
+/// @param [in] value Expected value
+/// @return 0 if thread was woken, -1 if value isn`t expected or wait was interrupted
+/// @note Futex is private for process
+int futexWait(unsigned *address, unsigned value);
+
+/// Wake threads which sleep in futexWait() on address
+/// @param [in] address Address of futex word
+/// @param [in] count Max count of woken threads
+/// @return Count of woken threads or -1 if was error
+int futexWake(unsigned *address, int count);
+
+/// Flush entry of file in its directory to disk, it makes rename or creation of file durable
+/// @param [in] fileName Name of file
+/// @return 0 if directory was flushed else -1
+int syncDirectory(const char *fileName);
+
+/// Get time of monotonic clock
+/// @return Time in nanoseconds from unspecified point
+unsigned long long getMonotonicTime();
+
+/// Map file to private memory, changes of memory aren`t written to file
+/// @param [in] fileName Name of file
+/// @param [out] size Size of mapped file
+/// @return Pointer to mapped file or NULL if was error in function
+/// @note Memory is freed by mapFree
+void *mapFile(const char *fileName, size_t *size);
+
 /// Check that address is corrrect for write
 /// @param [in] pointer Pointer for check
 /// @return Is pointer correct for write
@@ -0,0 +1,279 @@
+#include "list.h"
+#include "listerrors.h"
+#include "concurrentlist.h"
+#include "listslots.h"
+
+#include "logging.h"
+#include "systemlike.h"
+#include "asserts.h"
+
+void do_initConcurrentList(ConcurrentList *list, size_t capacity, DebugInfo info, int *error,
+                           ListStorage storage)
+{
+  if (!isPointerCorrect(list))
+    ERROR();
+
+  pthread_rwlockattr_t attributes = {};
+
+  if (pthread_rwlockattr_init(&attributes))
+    ERROR();
+
+  pthread_rwlockattr_setkind_np(&attributes, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+
+  int err = pthread_rwlock_init(&list->lock, &attributes);
+
+  pthread_rwlockattr_destroy(&attributes);
+
+  if (err)
+    ERROR();
+
+  list->slots = createSlotStack();
+
+  if (!list->slots)
+    ERROR();
+
+  do_initList(&list->list, capacity, info, error, storage);
+}
+
+void destroyConcurrentList(ConcurrentList *list, int *error)
+{
+  if (!isPointerCorrect(list))
+    ERROR();
+
+  destroyList(&list->list, error);
+
+  destroySlotStack(list->slots);
+
+  list->slots = nullptr;
+
+  pthread_rwlock_destroy(&list->lock);
+}
+
+const List *concurrentList_lockRead(ConcurrentList *list)
+{
+  assert(list);
+
+  pthread_rwlock_rdlock(&list->lock);
+
+  return &list->list;
+}
+
+List *concurrentList_lockWrite(ConcurrentList *list)
+{
+  assert(list);
+
+  pthread_rwlock_wrlock(&list->lock);
+
+  return &list->list;
+}
+
+void concurrentList_unlock(ConcurrentList *list)
+{
+  assert(list);
+
+  pthread_rwlock_unlock(&list->lock);
+}
+
+index_t concurrentList_insertElement(ConcurrentList *list, index_t anchor, element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  index_t index = list_insertElement(locked, anchor, element, error);
+
+  concurrentList_unlock(list);
+
+  return index;
+}
+
+index_t concurrentList_pushBackElement(ConcurrentList *list, element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  index_t index = list_pushBackElement(locked, element, error);
+
+  concurrentList_unlock(list);
+
+  return index;
+}
+
+index_t concurrentList_pushFrontElement(ConcurrentList *list, element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  index_t index = list_pushFrontElement(locked, element, error);
+
+  concurrentList_unlock(list);
+
+  return index;
+}
+
+index_t concurrentList_allocSlot(ConcurrentList *list, int *error)
+{
+  assert(list);
+
+  index_t index = popSlot(list->slots);
+
+  if (index != nullindex)
+    return index;
+
+  List *locked = concurrentList_lockWrite(list);
+
+  index = popSlot(list->slots);
+
+  if (index == nullindex)
+    {
+      index_t indexes[SLOT_BATCH_SIZE] = {};
+
+      int err = 0;
+
+      list_reserveSlots(locked, indexes, SLOT_BATCH_SIZE, &err);
+
+      if (!err && pushSlots(list->slots, indexes + 1, SLOT_BATCH_SIZE - 1))
+        {
+          for (size_t i = 0; i < SLOT_BATCH_SIZE; ++i)
+            list_releaseSlot(locked, indexes[i]);
+
+          err = -1;
+        }
+
+      if (!err)
+        index = indexes[0];
+    }
+
+  concurrentList_unlock(list);
+
+  if (index == nullindex)
+    ERROR(nullindex);
+
+  return index;
+}
+
+void concurrentList_releaseSlot(ConcurrentList *list, index_t index, int *error)
+{
+  assert(list);
+
+  if (pushSlot(list->slots, index))
+    ERROR();
+}
+
+void concurrentList_insertSlot(ConcurrentList *list, index_t anchor, index_t index,
+                               const element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  list_insertSlot(locked, anchor, index, element, error);
+
+  concurrentList_unlock(list);
+}
+
+void concurrentList_flushSlots(ConcurrentList *list, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  int err = 0;
+
+  for (index_t index = popSlot(list->slots); index != nullindex; index = popSlot(list->slots))
+    list_releaseSlot(locked, index, &err);
+
+  concurrentList_unlock(list);
+
+  if (err)
+    ERROR();
+}
+
+element_t *concurrentList_removeElement(ConcurrentList *list, index_t anchor, element_t *element,
+                                        int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  element_t *result = list_removeElement(locked, anchor, element, error);
+
+  concurrentList_unlock(list);
+
+  return result;
+}
+
+element_t *concurrentList_popBackElement(ConcurrentList *list, element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  element_t *result = list_popBackElement(locked, element, error);
+
+  concurrentList_unlock(list);
+
+  return result;
+}
+
+element_t *concurrentList_popFrontElement(ConcurrentList *list, element_t *element, int *error)
+{
+  List *locked = concurrentList_lockWrite(list);
+
+  element_t *result = list_popFrontElement(locked, element, error);
+
+  concurrentList_unlock(list);
+
+  return result;
+}
+
+element_t *concurrentList_get(ConcurrentList *list, index_t anchor, element_t *element, int *error)
+{
+  const List *locked = concurrentList_lockRead(list);
+
+  element_t *result = list_get(locked, anchor, element, error);
+
+  concurrentList_unlock(list);
+
+  return result;
+}
+
+element_t *concurrentList_getAt(ConcurrentList *list, size_t position, element_t *element,
+                                int *error)
+{
+  const List *locked = concurrentList_lockRead(list);
+
+  element_t *result = list_getAt(locked, position, element, error);
+
+  concurrentList_unlock(list);
+
+  return result;
+}
+
+size_t concurrentList_size(ConcurrentList *list, int *error)
+{
+  const List *locked = concurrentList_lockRead(list);
+
+  size_t size = list_size(locked, error);
+
+  concurrentList_unlock(list);
+
+  return size;
+}
+
+void concurrentList_forEach(ConcurrentList *list, list_visitor_t visitor, void *argument, int *error)
+{
+  if (!visitor)
+    ERROR();
+
+  const List *locked = concurrentList_lockRead(list);
+
+  unsigned errorCode = validateList(locked);
+
+  if (errorCode)
+    {
+      dumpList(locked, errorCode, lockLogFile());
+
+      unlockLogFile();
+
+      concurrentList_unlock(list);
+
+      if (isPointerCorrect(error))
+        *error = (int)errorCode;
+
+      return;
+    }
+
+  for (index_t curr = list_head(locked); curr != nullindex; curr = list_next(locked, curr))
+    visitor(argument, curr, list_element(locked, curr));
+
+  concurrentList_unlock(list);
+}
@@ -1,19 +1,13 @@
 #include "elementfunctions.h"
 
-#include <stdio.h>
-
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
 char *toString(int element)
 {
-  static char buff[10] = "";
-
-  sprintf(buff, "%4d", element);
-
-  return buff;
+  return ElementTraits<int>::toString(element);
 }
 
 int getPoison(int element)
 {
-  return -1;
+  return ElementTraits<int>::poison();
 }
@@ -1,72 +1,32 @@
 #include "list.h"
 #include "listdump.h"
+#include "listqueue.h"
+#include "elementfunctions.h"
 
 #include <stdio.h>
+#include <pthread.h>
 
 #include "systemlike.h"
 
-#pragma GCC diagnostic ignored "-Wsign-compare"
+static void printQueueFields(const ListQueue *queue, FILE *file);
 
-#define SEPARATOR "=========================================================="
+static void printQueueCells(const ListQueue *queue, FILE *file);
 
-const char *const ERROR_MESSAGE[] =
-  {
-    "Pointer to list is nullptr",
-    "Pointer to list is incorrect",
-    "Pointer to data is nullptr or incorrect when capacity isn`t 0",
-    "Capacity less than size",
-    "Head isn`t correct",
-    "Tail isn`t correct",
-    "Left canary died",
-    "Right canary died",
-    "Left data canary died",
-    "Right data canary died",
-    "Hash of list isn`t correct",
-    "Hash of data isn`t correct",
-    "Invalid free index",
-    "Free sequence is incorrect",
-    "Main sequence is incorrect"
-  };
-
-#ifdef DEBUG_BUILD_
-
-static void printDebugInfo(const List *list, FILE *file);
-
-#endif
-
-static void printCallInfo(
-                          const char *fileName,
-                          const char *functionName,
-                          int line,
-                          FILE *file
-                          );
-
-#ifdef NEED_HASH_
-
-static void printHash(const List *list, FILE *file);
-
-#endif
-
-static void printError(unsigned error, FILE *file);
-
-static void printFields(const List *list, FILE *file);
-
-static void printData(const List *list, FILE *file);
-
-void do_dumpList(
-              const List *list,
-              unsigned error,
-              FILE *file,
-              const char *fileName,
-              const char *functionName,
-              int line,
-              const char *message,
-              ...
-              )
+void do_dumpListQueue(
+                      const ListQueue *queue,
+                      FILE *file,
+                      const char *fileName,
+                      const char *functionName,
+                      int line,
+                      const char *message,
+                      ...
+                      )
 {
   if (!file)
     file = stdout;
 
+  pthread_mutex_lock(&DUMP_MUTEX);
+
   fprintf(file, "<h2>");
 
   va_list args = {};
@@ -79,132 +39,69 @@ void do_dumpList(
 
   fprintf(file, "</h2>\n");
 
-#ifdef DEBUG_BUILD_
-
-  printDebugInfo(list, file);
+  fprintf(file, "ListQueue[%p] ", (const void *)queue);
 
-#endif
+  printCallInfo(fileName, functionName, line, file);
 
-  fprintf(file, "List[%p] ", (const void *)list);
+  int isCorrect = isPointerCorrect(queue);
 
-  if (isPointerCorrect(list))
+  if (isCorrect)
     {
-      printCallInfo(fileName, functionName, line, file);
-
-#ifdef NEED_HASH_
+      printQueueFields(queue, file);
 
-      printHash(list, file);
-
-#endif
+      printQueueCells(queue, file);
     }
 
-  printError(error, file);
-
-  if (isPointerCorrect(list))
-    {
-      printFields(list, file);
-
-      printData(list, file);
-    }
+  pthread_mutex_unlock(&DUMP_MUTEX);
 
-  fputc('\n', file);
+  if (isCorrect)
+    do_dumpList(&queue->list, validateList(&queue->list), file, fileName, functionName, line,
+                "List of cells of ListQueue[%p]", (const void *)queue);
 }
 
-#ifdef DEBUG_BUILD_
-
-static void printDebugInfo(const List *list, FILE *file)
+static void printQueueFields(const ListQueue *queue, FILE *file)
 {
-  fprintf(
-          file,
-          "\"%s\" at %s at %s(%d)\n",
-          isPointerCorrect(list->info.name)         ? list->info.name         : "null",
-          isPointerCorrect(list->info.functionName) ? list->info.functionName : "null",
-          isPointerCorrect(list->info.fileName)     ? list->info.fileName     : "null",
-          list->info.line
-          );
-}
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
 
-#endif
+  fprintf(file, "size_t capacity = %zu;\n", queue->capacity);
 
-static void printCallInfo(
-                          const char *fileName,
-                          const char *functionName,
-                          int line,
-                          FILE *file
-                          )
-{
-  fprintf(
-          file,
-          "%s at %s(%d):\n",
-          isPointerCorrect(functionName) ? functionName : "null",
-          isPointerCorrect(fileName)     ? fileName     : "null",
-          line
-          );
-}
+  fprintf(file, "int mode = %d;\n", queue->mode);
 
-#ifdef NEED_HASH_
+  fprintf(file, "size_t tail = %zu;\n", queue->tail);
 
-static void printHash(const List *list, FILE *file)
-{
-  fprintf(file, "Hash: %X Data hash: %X\n", list->hash, list->dataHash);
-}
+  fprintf(file, "unsigned enqueueEvents = %u;\n", queue->enqueueEvents);
 
-#endif
+  fprintf(file, "unsigned producersWaiting = %u;\n", queue->producersWaiting);
 
-static void printError(unsigned error, FILE *file)
-{
-  if (!error)
-    {
-      fprintf(file, "No error\n");
+  fprintf(file, "size_t head = %zu;\n", queue->head);
 
-      return;
-    }
-
-  fprintf(file, "%s\n", SEPARATOR);
+  fprintf(file, "unsigned dequeueEvents = %u;\n", queue->dequeueEvents);
 
-  fprintf(file, "<font color = red />Erors:\n");
+  fprintf(file, "unsigned consumerWaiting = %u;\n", queue->consumerWaiting);
 
-  for (int i = 0; i < ERROR_COUNT; ++i)
-    if ((error >> i) & 0x01)
-      fprintf(file, "%s,\n", ERROR_MESSAGE[i]);
+  fprintf(file, "int isClosed = %d;\n", queue->isClosed);
 
-  fprintf(file, "<font color = black />%s\n", SEPARATOR);
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
 }
 
-static void printFields(const List *list, FILE *file)
+static void printQueueCells(const ListQueue *queue, FILE *file)
 {
-  fprintf(file, "%s\n", SEPARATOR);
-
-  fprintf(file, "canary_t leftCanary = %X;\n", list->leftCanary);
-
-  fprintf(file, "Node *data = %p;\n", (void *)list->data);
-
-  fprintf(file, "size_t capacity = %zu;\n", list->capacity);
+  if (!queue->capacity || !isPointerCorrect(queue->list.data))
+    return;
 
-  fprintf(file, "size_t size = %zu;\n", list->size);
+  size_t count = queue->tail - queue->head < queue->capacity ? queue->tail - queue->head : queue->capacity;
 
-  fprintf(file, "size_t head = %d;\n", list_head(list));
-
-  fprintf(file, "size_t tail = %d;\n", list_tail(list));
-
-  fprintf(file, "size_t free = %d;\n", list->free);
-
-  fprintf(file, "canary_t rightCanary = %X;\n", list->rightCanary);
-
-  fprintf(file, "%s\n", SEPARATOR);
-}
-
-static void printData(const List *list, FILE *file)
-{
-  const char *image = createImage(list);
-
-  fprintf(file, "<hr>\n");
+  for (size_t i = 0; i < count; ++i)
+    {
+      size_t position = queue->head + i;
 
-  fprintf(file, "<!%s>", SEPARATOR);
+      const Node *cell = queue->list.data + 1 + position % queue->capacity;
 
-  fprintf(file, "<image src=../%s />", image);
+      int isReady = (unsigned)cell->next == (unsigned)(position + 1);
 
-  fprintf(file, "<hr>\n");
+      fprintf(file, "%zu: Node %zu elem = %s sequence = %d%s\n", position, 1 + position % queue->capacity,
+              ElementTraits<element_t>::toString(cell->elem), cell->next, isReady ? "" : " (is written)");
+    }
 
-  fprintf(file, "<!%s>", SEPARATOR);
+  fprintf(file, "%s\n", DUMP_SEPARATOR);
 }
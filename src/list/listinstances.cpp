@@ -0,0 +1,15 @@
+#include "list.h"
+#include "listdump.h"
+
+/// Only instantiation of dump of List, other files have extern template from listdumpimpl.h
+template
+void do_dumpList<element_t, index_t>(
+                                     const List *list,
+                                     unsigned error,
+                                     FILE *file,
+                                     const char *fileName,
+                                     const char *functionName,
+                                     int line,
+                                     const char *message,
+                                     ...
+                                     );
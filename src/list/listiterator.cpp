@@ -20,7 +20,8 @@
                                                             \
       if (errorCode)                                        \
         {                                                   \
-          dumpList(LIST, errorCode, getLogFile());          \
+          dumpList(LIST, errorCode, lockLogFile());         \
+          unlockLogFile();                                  \
                                                             \
           return __VA_ARGS__ __VA_OPT__(;) (int)errorCode;  \
         }                                                   \
@@ -48,7 +49,7 @@ int next(ListIterator *iter)
 {
   CHECK(iter, 1);
 
-  iter->current = iter->list->data[iter->current].next;
+  iter->current = list_next(iter->list, iter->current);
 
   return 0;
 }
@@ -57,7 +58,7 @@ int prev(ListIterator *iter)
 {
   CHECK(iter, 1);
 
-  iter->current = iter->list->data[iter->current].prev;
+  iter->current = list_prev(iter->list, iter->current);
 
   return 0;
 }
@@ -66,7 +67,7 @@ int hasNext(ListIterator *iter)
 {
   CHECK(iter, 0);
 
-  return iter->list->data[iter->current].next != list_head(iter->list);
+  return list_next(iter->list, iter->current) != list_head(iter->list);
 }
 
 int hasPrev(ListIterator *iter)
@@ -87,12 +88,12 @@ element_t *value(MutableListIterator *iter)
 {
   CHECK(iter, nullptr);
 
- return &iter->list->data[iter->current].elem;
+  return list_element(iter->list, iter->current);
 }
 
 const element_t *value(ConstListIterator *iter)
 {
   CHECK(iter, nullptr);
 
-  return &iter->list->data[iter->current].elem;
+   return list_element(iter->list, iter->current);
 }
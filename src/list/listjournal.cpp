@@ -0,0 +1,110 @@
+#include "list.h"
+#include "listjournal.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "systemlike.h"
+
+ListJournal *openJournal(const char *journalName, const char *snapshotName, ListJournalPolicy policy)
+{
+  ListJournal *journal = (ListJournal *)calloc(1, sizeof(ListJournal));
+
+  if (!journal)
+    return nullptr;
+
+  journal->policy       = policy;
+  journal->snapshotName = strdup(snapshotName);
+
+  journal->fileDescriptor = open(journalName, O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+  if (!journal->snapshotName || journal->fileDescriptor == -1)
+    {
+      closeJournal(journal);
+
+      return nullptr;
+    }
+
+  return journal;
+}
+
+int closeJournal(ListJournal *journal)
+{
+  if (!journal)
+    return 0;
+
+  int error = 0;
+
+  if (journal->fileDescriptor != -1)
+    {
+      error = flushJournal(journal, 1);
+
+      if (close(journal->fileDescriptor))
+        error = -1;
+    }
+
+  free(journal->snapshotName);
+  free(journal->buffer);
+  free(journal);
+
+  return error;
+}
+
+int flushJournal(ListJournal *journal, int sync)
+{
+  if (journal->bufferSize)
+    {
+      if (writeFull(journal->fileDescriptor, journal->buffer, journal->bufferSize))
+        return -1;
+
+      journal->fileSize += journal->bufferSize;
+
+      journal->bufferSize  = 0;
+      journal->recordCount = 0;
+
+      ++journal->writeCount;
+    }
+
+  if (sync || (journal->policy.syncPeriod && journal->writeCount >= journal->policy.syncPeriod))
+    {
+      if (fsync(journal->fileDescriptor))
+        return -1;
+
+      journal->writeCount = 0;
+    }
+
+  return 0;
+}
+
+int resetJournal(ListJournal *journal, hash_t snapshotHash)
+{
+  journal->bufferSize  = 0;
+  journal->recordCount = 0;
+  journal->writeCount  = 0;
+
+  ListJournalHeader header = {};
+
+  memset(&header, 0, sizeof(header));
+
+  header.magic        = LIST_JOURNAL_MAGIC;
+  header.version      = LIST_JOURNAL_VERSION;
+  header.snapshotHash = snapshotHash;
+  header.hash         = getJournalHeaderHash(&header);
+
+  if (ftruncate(journal->fileDescriptor, 0) ||
+      writeFull(journal->fileDescriptor, &header, sizeof(header)) ||
+      fsync(journal->fileDescriptor))
+    return -1;
+
+  journal->fileSize = sizeof(header);
+
+  return 0;
+}
+
+int isCheckpointNeeded(const ListJournal *journal)
+{
+  return journal->policy.checkpointSize &&
+         journal->fileSize + journal->bufferSize >= journal->policy.checkpointSize;
+}
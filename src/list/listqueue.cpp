@@ -0,0 +1,286 @@
+#include "list.h"
+#include "listerrors.h"
+#include "listqueue.h"
+
+#include <limits.h>
+
+#include "systemlike.h"
+#include "elementfunctions.h"
+
+/// Node of cell for position of enqueue or dequeue
+static Node *getCell(ListQueue *queue, size_t position);
+
+/// Difference between sequence of cell and position, sequences are compared modulo 2^32
+static int getDistance(index_t sequence, size_t position);
+
+/// Check that cell at ListQueue::head has element
+static int isHeadReady(ListQueue *queue);
+
+/// Wait until cell at ListQueue::head has element
+/// @return 1 if element is ready, 0 if queue is empty and closed
+static int waitForElement(ListQueue *queue);
+
+/// Wake consumer if it waits for element
+static void notifyConsumer(ListQueue *queue);
+
+/// Wake up to count producers if they wait for free cell
+static void notifyProducers(ListQueue *queue, size_t count);
+
+void do_initListQueue(ListQueue *queue, size_t capacity, DebugInfo info, int *error, ListQueueMode mode)
+{
+  if (!isPointerCorrect(queue) || !capacity || capacity >= INT_MAX)
+    ERROR();
+
+  queue->capacity = capacity;
+  queue->mode     = mode;
+
+  queue->tail             = 0;
+  queue->enqueueEvents    = 0;
+  queue->producersWaiting = 0;
+
+  queue->head            = 0;
+  queue->dequeueEvents   = 0;
+  queue->consumerWaiting = 0;
+  queue->isClosed        = 0;
+
+  int err = 0;
+
+  do_initList(&queue->list, capacity, info, &err, LIST_STORAGE_AOS);
+
+  if (err)
+    ERROR();
+
+  for (size_t i = 0; i < capacity; ++i)
+    queue->list.data[i + 1] = {ElementTraits<element_t>::poison(), (index_t)i, nullindex};
+}
+
+void destroyListQueue(ListQueue *queue, int *error)
+{
+  if (!isPointerCorrect(queue))
+    ERROR();
+
+  destroyList(&queue->list, error);
+
+  queue->capacity = 0;
+  queue->tail     = 0;
+  queue->head     = 0;
+}
+
+int listQueue_tryEnqueue(ListQueue *queue, element_t element)
+{
+  if (__atomic_load_n(&queue->isClosed, __ATOMIC_RELAXED))
+    return 0;
+
+  size_t position = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+  Node *cell = nullptr;
+
+  while (true)
+    {
+      cell = getCell(queue, position);
+
+      int distance = getDistance(__atomic_load_n(&cell->next, __ATOMIC_ACQUIRE), position);
+
+      if (distance < 0)
+        return 0;
+
+      if (distance > 0)
+        {
+          position = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+          continue;
+        }
+
+      if (queue->mode == LIST_QUEUE_SPSC)
+        {
+          __atomic_store_n(&queue->tail, position + 1, __ATOMIC_RELAXED);
+
+          break;
+        }
+
+      if (__atomic_compare_exchange_n(&queue->tail, &position, position + 1, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    }
+
+  cell->elem = element;
+
+  __atomic_store_n(&cell->next, (index_t)(position + 1), __ATOMIC_RELEASE);
+
+  notifyConsumer(queue);
+
+  return 1;
+}
+
+int listQueue_enqueue(ListQueue *queue, element_t element)
+{
+  while (true)
+    {
+      if (listQueue_tryEnqueue(queue, element))
+        return 1;
+
+      __atomic_add_fetch(&queue->producersWaiting, 1, __ATOMIC_RELAXED);
+
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+      unsigned events = __atomic_load_n(&queue->dequeueEvents, __ATOMIC_SEQ_CST);
+
+      int isEnqueued = listQueue_tryEnqueue(queue, element);
+      int isClosed   = __atomic_load_n(&queue->isClosed, __ATOMIC_SEQ_CST);
+
+      if (!isEnqueued && !isClosed)
+        futexWait(&queue->dequeueEvents, events);
+
+      __atomic_sub_fetch(&queue->producersWaiting, 1, __ATOMIC_RELAXED);
+
+      if (isEnqueued)
+        return 1;
+
+      if (isClosed)
+        return 0;
+    }
+}
+
+int listQueue_tryDequeue(ListQueue *queue, element_t *element)
+{
+  if (!isHeadReady(queue))
+    return 0;
+
+  size_t position = queue->head;
+
+  Node *cell = getCell(queue, position);
+
+  *element = cell->elem;
+
+  __atomic_store_n(&cell->next, (index_t)(position + queue->capacity), __ATOMIC_RELEASE);
+  __atomic_store_n(&queue->head, position + 1, __ATOMIC_RELAXED);
+
+  notifyProducers(queue, 1);
+
+  return 1;
+}
+
+int listQueue_dequeue(ListQueue *queue, element_t *element)
+{
+  if (!waitForElement(queue))
+    return 0;
+
+  return listQueue_tryDequeue(queue, element);
+}
+
+size_t listQueue_dequeueBatch(ListQueue *queue, element_t *elements, size_t count)
+{
+  if (!count || !waitForElement(queue))
+    return 0;
+
+  size_t position = queue->head;
+  size_t taken    = 0;
+
+  while (taken < count)
+    {
+      Node *cell = getCell(queue, position);
+
+      if (getDistance(__atomic_load_n(&cell->next, __ATOMIC_ACQUIRE), position + 1))
+        break;
+
+      elements[taken++] = cell->elem;
+
+      __atomic_store_n(&cell->next, (index_t)(position + queue->capacity), __ATOMIC_RELEASE);
+
+      ++position;
+    }
+
+  __atomic_store_n(&queue->head, position, __ATOMIC_RELAXED);
+
+  notifyProducers(queue, taken);
+
+  return taken;
+}
+
+void listQueue_close(ListQueue *queue)
+{
+  __atomic_store_n(&queue->isClosed, 1, __ATOMIC_SEQ_CST);
+
+  __atomic_add_fetch(&queue->enqueueEvents, 1, __ATOMIC_SEQ_CST);
+  __atomic_add_fetch(&queue->dequeueEvents, 1, __ATOMIC_SEQ_CST);
+
+  futexWake(&queue->enqueueEvents, INT_MAX);
+  futexWake(&queue->dequeueEvents, INT_MAX);
+}
+
+size_t listQueue_size(const ListQueue *queue)
+{
+  size_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+  size_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+  if (tail <= head)
+    return 0;
+
+  return tail - head < queue->capacity ? tail - head : queue->capacity;
+}
+
+static Node *getCell(ListQueue *queue, size_t position)
+{
+  return queue->list.data + 1 + position % queue->capacity;
+}
+
+static int getDistance(index_t sequence, size_t position)
+{
+  return (int)((unsigned)sequence - (unsigned)position);
+}
+
+static int isHeadReady(ListQueue *queue)
+{
+  size_t position = queue->head;
+
+  return !getDistance(__atomic_load_n(&getCell(queue, position)->next, __ATOMIC_ACQUIRE), position + 1);
+}
+
+static int waitForElement(ListQueue *queue)
+{
+  while (!isHeadReady(queue))
+    {
+      __atomic_store_n(&queue->consumerWaiting, 1, __ATOMIC_RELAXED);
+
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+      unsigned events = __atomic_load_n(&queue->enqueueEvents, __ATOMIC_SEQ_CST);
+
+      int isReady  = isHeadReady(queue);
+      int isClosed = __atomic_load_n(&queue->isClosed, __ATOMIC_SEQ_CST);
+
+      if (!isReady && !isClosed)
+        futexWait(&queue->enqueueEvents, events);
+
+      __atomic_store_n(&queue->consumerWaiting, 0, __ATOMIC_RELAXED);
+
+      if (!isReady && isClosed)
+        return isHeadReady(queue);
+    }
+
+  return 1;
+}
+
+static void notifyConsumer(ListQueue *queue)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if (!__atomic_load_n(&queue->consumerWaiting, __ATOMIC_RELAXED))
+    return;
+
+  __atomic_add_fetch(&queue->enqueueEvents, 1, __ATOMIC_SEQ_CST);
+
+  futexWake(&queue->enqueueEvents, 1);
+}
+
+static void notifyProducers(ListQueue *queue, size_t count)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if (!count || !__atomic_load_n(&queue->producersWaiting, __ATOMIC_RELAXED))
+    return;
+
+  __atomic_add_fetch(&queue->dequeueEvents, 1, __ATOMIC_SEQ_CST);
+
+  futexWake(&queue->dequeueEvents, count < INT_MAX ? (int)count : INT_MAX);
+}
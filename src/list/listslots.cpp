@@ -0,0 +1,141 @@
+#include "list.h"
+#include "listslots.h"
+
+#include <stdlib.h>
+#include <limits.h>
+
+/// Mask of index in SlotStack::top
+const unsigned long long SLOT_INDEX_MASK = 0xFFFFFFFFull;
+
+/// Tag of top of SlotStack
+const unsigned SLOT_TAG_SHIFT = 32;
+
+/// Pointer to link of slot, chunk of link is allocated if it is needed
+static index_t *getLink(SlotStack *stack, index_t index);
+
+/// Top with index of slot and next tag after old top
+static unsigned long long makeTop(unsigned long long oldTop, index_t index);
+
+SlotStack *createSlotStack()
+{
+  SlotStack *stack = (SlotStack *)calloc(1, sizeof(SlotStack));
+
+  if (!stack)
+    return nullptr;
+
+  stack->chunkCount = ((size_t)INT_MAX >> STORAGE_CHUNK_SHIFT) + 1;
+  stack->chunks     = (index_t **)calloc(stack->chunkCount, sizeof(index_t *));
+
+  if (!stack->chunks)
+    {
+      free(stack);
+
+      return nullptr;
+    }
+
+  stack->top   = nullindex;
+  stack->count = 0;
+
+  return stack;
+}
+
+void destroySlotStack(SlotStack *stack)
+{
+  if (!stack)
+    return;
+
+  for (size_t i = 0; i < stack->chunkCount; ++i)
+    free(stack->chunks[i]);
+
+  free(stack->chunks);
+  free(stack);
+}
+
+int pushSlots(SlotStack *stack, const index_t *indexes, size_t count)
+{
+  if (!count)
+    return 0;
+
+  for (size_t i = 0; i < count; ++i)
+    if (indexes[i] <= nullindex || !getLink(stack, indexes[i]))
+      return -1;
+
+  for (size_t i = 0; i + 1 < count; ++i)
+    __atomic_store_n(getLink(stack, indexes[i]), indexes[i + 1], __ATOMIC_RELAXED);
+
+  index_t *lastLink = getLink(stack, indexes[count - 1]);
+
+  __atomic_add_fetch(&stack->count, count, __ATOMIC_RELAXED);
+
+  unsigned long long oldTop = __atomic_load_n(&stack->top, __ATOMIC_RELAXED);
+
+  do
+    __atomic_store_n(lastLink, (index_t)(oldTop & SLOT_INDEX_MASK), __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&stack->top, &oldTop, makeTop(oldTop, indexes[0]), 1,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+  return 0;
+}
+
+int pushSlot(SlotStack *stack, index_t index)
+{
+  return pushSlots(stack, &index, 1);
+}
+
+index_t popSlot(SlotStack *stack)
+{
+  unsigned long long oldTop = __atomic_load_n(&stack->top, __ATOMIC_ACQUIRE);
+
+  for (;;)
+    {
+      index_t index = (index_t)(oldTop & SLOT_INDEX_MASK);
+
+      if (index == nullindex)
+        return nullindex;
+
+      index_t next = __atomic_load_n(getLink(stack, index), __ATOMIC_RELAXED);
+
+      if (__atomic_compare_exchange_n(&stack->top, &oldTop, makeTop(oldTop, next), 1,
+                                      __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+          __atomic_sub_fetch(&stack->count, 1, __ATOMIC_RELAXED);
+
+          return index;
+        }
+    }
+}
+
+size_t getSlotCount(const SlotStack *stack)
+{
+  return __atomic_load_n(&stack->count, __ATOMIC_RELAXED);
+}
+
+static index_t *getLink(SlotStack *stack, index_t index)
+{
+  size_t chunk = (size_t)index >> STORAGE_CHUNK_SHIFT;
+
+  index_t *links = __atomic_load_n(&stack->chunks[chunk], __ATOMIC_ACQUIRE);
+
+  if (!links)
+    {
+      index_t *newLinks = (index_t *)calloc(STORAGE_CHUNK_SIZE, sizeof(index_t));
+
+      if (!newLinks)
+        return nullptr;
+
+      if (__atomic_compare_exchange_n(&stack->chunks[chunk], &links, newLinks, 0,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        links = newLinks;
+      else
+        free(newLinks);
+    }
+
+  return &links[(size_t)index & (STORAGE_CHUNK_SIZE - 1)];
+}
+
+static unsigned long long makeTop(unsigned long long oldTop, index_t index)
+{
+  unsigned long long tag = (oldTop >> SLOT_TAG_SHIFT) + 1;
+
+  return (tag << SLOT_TAG_SHIFT) | ((unsigned long long)(unsigned)index & SLOT_INDEX_MASK);
+}
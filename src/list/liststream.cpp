@@ -0,0 +1,230 @@
+#include "list.h"
+#include "listerrors.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "logging.h"
+#include "systemlike.h"
+#include "asserts.h"
+
+/// Max count of bits in varint of element, it has at most 5 bytes
+const unsigned ELEMENT_VARINT_BITS = 35;
+
+/// Max count of bits in varint of count of elements, it has at most 10 bytes
+const unsigned COUNT_VARINT_BITS = 70;
+
+/// Write value as varint, 7 bits in byte from low ones
+static unsigned char *writeVarint(unsigned char *buffer, unsigned long long value);
+
+/// Difference of elements in zigzag form, small differences of both signs are small
+static unsigned encodeDifference(element_t last, element_t element);
+
+/// Element from last and zigzag form of difference
+static element_t decodeDifference(element_t last, unsigned long long value);
+
+ListWriter list_getWriter(const List *list)
+{
+  assert(list);
+
+  ListWriter writer{list, list_head(list), element_t {}, 0};
+
+  return writer;
+}
+
+size_t list_writeChunk(ListWriter *writer, void *buffer, size_t size, int *error)
+{
+  assert(writer);
+
+  CHECK_VALID(writer->list, error, 0);
+
+  if (!buffer || size < LIST_STREAM_MAX_RECORD)
+    ERROR(0);
+
+  unsigned char *curr = (unsigned char *)buffer;
+  unsigned char *end  = curr + size;
+
+  if (!writer->isCountWritten)
+    {
+      curr = writeVarint(curr, writer->list->size);
+
+      writer->isCountWritten = 1;
+    }
+
+  const List *list = writer->list;
+
+  while (writer->current != nullindex && (size_t)(end - curr) >= LIST_STREAM_MAX_RECORD)
+    {
+      element_t element = *list_element(list, writer->current);
+
+      curr = writeVarint(curr, encodeDifference(writer->last, element));
+
+      writer->last    = element;
+      writer->current = list_next(list, writer->current);
+    }
+
+  return (size_t)(curr - (unsigned char *)buffer);
+}
+
+void list_writeToFd(const List *list, int fileDescriptor, int *error)
+{
+  CHECK_VALID(list, error);
+
+  unsigned char *buffer = (unsigned char *)calloc(STREAM_BUFFER_SIZE, sizeof(unsigned char));
+
+  if (!buffer)
+    ERROR();
+
+  ListWriter writer = list_getWriter(list);
+
+  int err = 0;
+
+  for (size_t size = 0; (size = list_writeChunk(&writer, buffer, STREAM_BUFFER_SIZE, &err)); )
+    if (writeFull(fileDescriptor, buffer, size))
+      {
+        err = -1;
+
+        break;
+      }
+
+  free(buffer);
+
+  CHECK_ERROR(err, error);
+}
+
+ListReader list_getReader(List *list)
+{
+  assert(list);
+
+  ListReader reader{list, 0, 0, element_t {}, 0, 0, 0, 0};
+
+  return reader;
+}
+
+size_t list_readChunk(ListReader *reader, const void *buffer, size_t size, int *error)
+{
+  assert(reader);
+
+  CHECK_VALID(reader->list, error, 0);
+
+  if (!buffer && size)
+    ERROR(0);
+
+  element_t *elements = (element_t *)calloc(size + 1, sizeof(element_t));
+
+  if (!elements)
+    ERROR(0);
+
+  const unsigned char *curr = (const unsigned char *)buffer;
+  const unsigned char *end  = curr + size;
+
+  size_t count = 0;
+
+  int err = 0;
+
+  for ( ; curr < end && !reader->isFinished; ++curr)
+    {
+      if (reader->shift >= (reader->isCountRead ? ELEMENT_VARINT_BITS : COUNT_VARINT_BITS))
+        {
+          err = -1;
+
+          break;
+        }
+
+      reader->value |= (unsigned long long)(*curr & 0x7F) << reader->shift;
+      reader->shift += 7;
+
+      if (*curr & 0x80)
+        continue;
+
+      if (!reader->isCountRead)
+        {
+          reader->count       = (size_t)reader->value;
+          reader->isCountRead = 1;
+          reader->isFinished  = !reader->count;
+
+          if (!reader->list->size && reader->list->capacity <= reader->count)
+            list_resize(reader->list, reader->count + 1, 0, &err);
+        }
+      else
+        {
+          reader->last = decodeDifference(reader->last, reader->value);
+
+          elements[count++] = reader->last;
+
+          reader->isFinished = ++reader->read == reader->count;
+        }
+
+      reader->value = 0;
+      reader->shift = 0;
+    }
+
+  if (!err && count)
+    {
+      index_t first = list_pushBackRange(reader->list, elements, count, &err);
+
+      (void)first;
+    }
+
+  free(elements);
+
+  CHECK_ERROR(err, error, 0);
+
+  return (size_t)(curr - (const unsigned char *)buffer);
+}
+
+void list_readFromFd(List *list, int fileDescriptor, int *error)
+{
+  CHECK_VALID(list, error);
+
+  unsigned char *buffer = (unsigned char *)calloc(STREAM_BUFFER_SIZE, sizeof(unsigned char));
+
+  if (!buffer)
+    ERROR();
+
+  ListReader reader = list_getReader(list);
+
+  int err = 0;
+
+  while (!err && !reader.isFinished)
+    {
+      ssize_t size = read(fileDescriptor, buffer, STREAM_BUFFER_SIZE);
+
+      if (size <= 0)
+        err = -1;
+      else
+        list_readChunk(&reader, buffer, (size_t)size, &err);
+    }
+
+  free(buffer);
+
+  CHECK_ERROR(err, error);
+}
+
+static unsigned char *writeVarint(unsigned char *buffer, unsigned long long value)
+{
+  while (value >= 0x80)
+    {
+      *buffer++ = (unsigned char)(value | 0x80);
+
+      value >>= 7;
+    }
+
+  *buffer++ = (unsigned char)value;
+
+  return buffer;
+}
+
+static unsigned encodeDifference(element_t last, element_t element)
+{
+  unsigned difference = (unsigned)element - (unsigned)last;
+
+  return (difference << 1) ^ (0u - (difference >> 31));
+}
+
+static element_t decodeDifference(element_t last, unsigned long long value)
+{
+  unsigned difference = (unsigned)(value >> 1) ^ (0u - (unsigned)(value & 1));
+
+  return (element_t)((unsigned)last + difference);
+}
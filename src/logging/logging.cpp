@@ -1,9 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <time.h>
 #include <string.h>
 #include <ctype.h>
 #include <sys/stat.h>
+#include <pthread.h>
 #include "logging.h"
 #include "systemlike.h"
 
@@ -28,7 +30,9 @@
                                                                 \
       time_t LOG_TIME_TEMP = 0;                                 \
       time(&LOG_TIME_TEMP);                                     \
-      fprintf(LOG_FILE, "%s", ctime(&LOG_TIME_TEMP));           \
+      char LOG_TIME_STRING[32] = "";                            \
+      fprintf(LOG_FILE, "%s",                                   \
+              ctime_r(&LOG_TIME_TEMP, LOG_TIME_STRING));        \
                                                                 \
       fprintf(LOG_FILE, SEPARATOR " START " SEPARATOR "\n\n");  \
                                                                 \
@@ -52,7 +56,9 @@
                                                                 \
       time_t LOG_TIME_TEMP = 0;                                 \
       time(&LOG_TIME_TEMP);                                     \
-      fprintf(LOG_FILE, "%s", ctime(&LOG_TIME_TEMP));           \
+      char LOG_TIME_STRING[32] = "";                            \
+      fprintf(LOG_FILE, "%s",                                   \
+              ctime_r(&LOG_TIME_TEMP, LOG_TIME_STRING));        \
                                                                 \
       fprintf(LOG_FILE, SEPARATOR "NEWFILE" SEPARATOR "\n\n");  \
                                                                 \
@@ -74,8 +80,12 @@ static void destroyLog();
 /// @note Don`t auto close files
 static int openNewLogFile();
 
+/// Print to LOG_FILE under LOG_FILE_MUTEX, so file isn`t rotated while it is written
+/// @return Count of print chars
+static int printLog(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
 /// Return C-like string with data and time information
-/// @return C-like string in static array
+/// @return C-like string in array of calling thread
 static const char *getDataString();
 
 /// Generate new log file name using LOG_FILE_PREFIX and LOG_FILE_SUFFIX
@@ -90,6 +100,8 @@ static char    *LOG_FILE_NAME     = nullptr;
 
 static size_t   MAX_LOG_FILE_SIZE = 1024 * 1024 * 256;
 
+static pthread_mutex_t LOG_FILE_MUTEX = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
 static unsigned initLog()
 {
   if (!isFileExists(LOG_DIRECTORY))
@@ -133,6 +145,8 @@ static unsigned initLog()
 
 static void destroyLog()
 {
+  pthread_mutex_lock(&LOG_FILE_MUTEX);
+
   if (isPointerCorrect(LOG_FILE))
     {
       END_LOG;
@@ -148,10 +162,14 @@ static void destroyLog()
   LOG_FILE_NAME = nullptr;
 
   LOG_LEVEL = 0;
+
+  pthread_mutex_unlock(&LOG_FILE_MUTEX);
 }
 
-FILE *getLogFile()
+FILE *lockLogFile()
 {
+  pthread_mutex_lock(&LOG_FILE_MUTEX);
+
   int isNameCorrect = isPointerCorrect(LOG_FILE_NAME);
 
   int isFileFull    = getFileSize(LOG_FILE_NAME) >= MAX_LOG_FILE_SIZE;
@@ -167,27 +185,29 @@ FILE *getLogFile()
 
       free(LOG_FILE_NAME);
 
-      if (!openNewLogFile())
-        return nullptr;
-
-      NEW_LOG_FILE;
+      if (openNewLogFile())
+        NEW_LOG_FILE;
     }
   else if (!isNameCorrect && isFileFull)
     {
-      if (!openNewLogFile())
-        return nullptr;
-
-      NEW_LOG_FILE;
+      if (openNewLogFile())
+        NEW_LOG_FILE;
     }
 
   return LOG_FILE;
 }
 
+void unlockLogFile()
+{
+  pthread_mutex_unlock(&LOG_FILE_MUTEX);
+}
+
 char *getNewLogFileName()
 {
   time_t now = 0;
   time(&now);
-  char *dataString = ctime(&now);
+  char dataString[32] = "";
+  ctime_r(&now, dataString);
 
   for (int i = 0; dataString[i]; ++i)
     if (isspace(dataString[i]) || ispunct(dataString[i]))
@@ -233,11 +253,6 @@ int loggingPrint(unsigned level, long long value, const char *name,
   if (!(LOG_LEVEL & level))
     return 0;
 
-  FILE *filePtr = getLogFile();
-
-  if (!isPointerCorrect(filePtr))
-    return 0;
-
   const char *dataString = getDataString();
 
   if (!isPointerCorrect(dataString))
@@ -247,16 +262,16 @@ int loggingPrint(unsigned level, long long value, const char *name,
     {
     case VALUE:
 
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. Decimal value of '%s': %lld.",
-                     dataString, fileName, functionName, line, name, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. Decimal value of '%s': %lld.",
+                      dataString, fileName, functionName, line, name, value);
     case MESSAGE:
     case WARNING:
     case ERROR:
     case FATAL:
     default:
 
-      fprintf(filePtr, "Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
-              fileName, functionName, line);
+      printLog("Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
+               fileName, functionName, line);
 
       return 0;
     }
@@ -281,11 +296,6 @@ int loggingPrint(unsigned level, double value, const char *name,
   if (!(LOG_LEVEL & level))
     return 0;
 
-  FILE *filePtr = getLogFile();
-
-  if (!isPointerCorrect(filePtr))
-    return 0;
-
   const char *dataString = getDataString();
 
   if (!isPointerCorrect(dataString))
@@ -294,16 +304,16 @@ int loggingPrint(unsigned level, double value, const char *name,
   switch (level)
     {
     case VALUE:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. Double value of '%s': %lf.",
-                     dataString, fileName, functionName, line, name, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. Double value of '%s': %lf.",
+                      dataString, fileName, functionName, line, name, value);
 
     case MESSAGE:
     case WARNING:
     case ERROR:
     case FATAL:
     default:
-      fprintf(filePtr, "Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
-              fileName, functionName, line);
+      printLog("Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
+               fileName, functionName, line);
 
       return 0;
     }
@@ -329,11 +339,6 @@ int loggingPrint(unsigned level, char value, const char *name,
   if (!(LOG_LEVEL & level))
     return 0;
 
-  FILE *filePtr = getLogFile();
-
-  if (!isPointerCorrect(filePtr))
-    return 0;
-
   const char *dataString = getDataString();
 
   if (!isPointerCorrect(dataString))
@@ -342,16 +347,16 @@ int loggingPrint(unsigned level, char value, const char *name,
   switch (level)
     {
     case VALUE:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. Char value of '%s': '%c'.",
-                     dataString, fileName, functionName, line, name, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. Char value of '%s': '%c'.",
+                      dataString, fileName, functionName, line, name, value);
 
     case MESSAGE:
     case WARNING:
     case ERROR:
     case FATAL:
     default:
-      fprintf(filePtr, "Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
-              fileName, functionName, line);
+      printLog("Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
+               fileName, functionName, line);
 
       return 0;
     }
@@ -376,11 +381,6 @@ int loggingPrint(unsigned level, const void *value, const char *name,
   if (!(LOG_LEVEL & level))
     return 0;
 
-  FILE *filePtr = getLogFile();
-
-  if (!isPointerCorrect(filePtr))
-    return 0;
-
   const char *dataString = getDataString();
 
   if (!isPointerCorrect(dataString))
@@ -389,16 +389,16 @@ int loggingPrint(unsigned level, const void *value, const char *name,
   switch (level)
     {
     case VALUE:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. Pointer value of '%s': %p.",
-                     dataString, fileName, functionName, line, name, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. Pointer value of '%s': %p.",
+                      dataString, fileName, functionName, line, name, value);
 
     case MESSAGE:
     case WARNING:
     case ERROR:
     case FATAL:
     default:
-      fprintf(filePtr, "Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
-              fileName, functionName, line);
+      printLog("Incorrect use of log functions!! File: %30s, Function: %60s, Line: %5d.",
+               fileName, functionName, line);
 
       return 0;
     }
@@ -419,11 +419,6 @@ int loggingPrint(unsigned level, const char *value, const char *name,
   if (!(LOG_LEVEL & level))
     return 0;
 
-  FILE *filePtr = getLogFile();
-
-  if (!isPointerCorrect(filePtr))
-    return 0;
-
   const char *dataString = getDataString();
 
   if (!isPointerCorrect(dataString))
@@ -432,28 +427,28 @@ int loggingPrint(unsigned level, const char *value, const char *name,
   switch (level)
     {
     case VALUE:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. C-like string value of '%s': \"%s\".",
-                     dataString, fileName, functionName, line, name, value ? value : "nullptr");
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. C-like string value of '%s': \"%s\".",
+                      dataString, fileName, functionName, line, name, value ? value : "nullptr");
 
     case MESSAGE:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. Message: \"%s\".",
-                     dataString, fileName, functionName, line, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. Message: \"%s\".",
+                      dataString, fileName, functionName, line, value);
 
     case WARNING:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. WARNING!!: \"%s\".",
-                     dataString, fileName, functionName, line, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. WARNING!!: \"%s\".",
+                      dataString, fileName, functionName, line, value);
 
     case ERROR:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. ERROR!!: \"%s\".",
-                     dataString, fileName, functionName, line, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. ERROR!!: \"%s\".",
+                      dataString, fileName, functionName, line, value);
 
     case FATAL:
-      return fprintf(filePtr, "[%s] File: %30s, Function: %60s, Line: %5d. !!FATAL ERROR!!: \"%s\".",
-                     dataString, fileName, functionName, line, value);
+      return printLog("[%s] File: %30s, Function: %60s, Line: %5d. !!FATAL ERROR!!: \"%s\".",
+                      dataString, fileName, functionName, line, value);
 
     default:
-      return fprintf(filePtr, "Incorrect use of log functions!! File: %30s, Function: %60s, Line %5d.",
-                     fileName, functionName, line);
+      return printLog("Incorrect use of log functions!! File: %30s, Function: %60s, Line %5d.",
+                      fileName, functionName, line);
 
       return 0;
     }
@@ -477,13 +472,37 @@ static int openNewLogFile()
   return 1;
 }
 
+static int printLog(const char *format, ...)
+{
+  FILE *logFile = lockLogFile();
+
+  int printed = 0;
+
+  if (isPointerCorrect(logFile))
+    {
+      va_list arguments;
+
+      va_start(arguments, format);
+
+      printed = vfprintf(logFile, format, arguments);
+
+      va_end(arguments);
+    }
+
+  unlockLogFile();
+
+  return printed;
+}
+
 static const char *getDataString()
 {
+  static thread_local char dataString[32] = "";
+
   time_t now = 0;
 
   time(&now);
 
-  char *dataString = ctime(&now);
+  ctime_r(&now, dataString);
 
   char *newLine = strchr(dataString, '\n');
   if (isPointerCorrect(newLine))
@@ -12,7 +12,7 @@ int main()
 
   initList(&list, 10);
 
-  FILE *file = getLogFile();
+  FILE *file = lockLogFile();
 
   dumpListWithMessage(&list, validateList(&list), file, "Start");
 
@@ -80,6 +80,8 @@ int main()
 
   dumpListWithMessage(&list, validateList(&list), file, "End");
 
+  unlockLogFile();
+
   destroyList(&list);
 
   return 0;
@@ -1,17 +1,385 @@
 #include "hash.h"
 #include "systemlike.h"
 
+#include <string.h>
+#include <immintrin.h>
+
 const hash_t DEFAULT_HASH_OFFSET = 17;
 
+const hash_t CELL_INDEX_MULTIPLIER = 0x9E3779B9;
+const hash_t CELL_MIX_MULTIPLIER   = 0x85EBCA6B;
+
+const unsigned long long WORD_HASH_MULTIPLIER = 0x9E3779B97F4A7C15;
+
+const size_t SIMD_HASH_LANES      = 8;
+const size_t SIMD_HASH_STRIPE     = SIMD_HASH_LANES*sizeof(hash_t);
+const hash_t SIMD_LANE_MULTIPLIER = 0x01000193;
+
+const hash_t CRC32C_POLYNOMIAL = 0x82F63B78;
+const hash_t CRC32C_START      = 0xFFFFFFFF;
+
+struct Crc32cTable {
+  hash_t value[256];
+};
+
+static constexpr Crc32cTable createCrc32cTable();
+
+static const Crc32cTable CRC32C_TABLE = createCrc32cTable();
+
+/// Mix word into 64-bit state of getWordHash()
+static unsigned long long mixWord(unsigned long long hash, unsigned long long word);
+
+/// Mix 32-bit word into one lane of getSimdHash()
+static hash_t mixLane(hash_t lane, hash_t word);
+
+/// Mix cell index into hash of cell, last step of getCellHash()
+static hash_t mixCellIndex(hash_t hash, size_t cellIndex);
+
+/// Process stripes of getSimdHash() without vector instructions
+static void hashSimdLanes      (hash_t *lanes, const char *data, size_t stripes);
+
+/// Process stripes of getSimdHash() with AVX2
+static void hashSimdLanesAvx2  (hash_t *lanes, const char *data, size_t stripes);
+
+/// Fold lanes of getSimdHash() of data with size bytes to one state which takes tail words
+static hash_t foldSimdLanes(const hash_t *lanes, size_t size);
+
+/// Sum of getCellHash() with getSimdHash() of cells shorter than stripe, each AVX2 lane hashes its own cell
+static hash_t getSimdCellsHashAvx2(const char *cells, size_t cellSize, size_t cellCount, size_t firstIndex);
+
+/// CRC32C without special instructions
+static hash_t getCrc32cSoftware(const char *data, size_t size);
+
+/// CRC32C with SSE4.2 crc32 instruction
+static hash_t getCrc32cSse42   (const char *data, size_t size);
+
+/// Check that CPU supports instruction set
+static int isCpuSupports(const char *instructionSet);
+
 hash_t getHash(const void *dataStart, const void *dataEnd)
 {
   if (!isPointerCorrect(dataStart) || !isPointerCorrect(dataEnd))
     return 0;
 
-  int hash = DEFAULT_HASH_OFFSET;
+  hash_t hash = DEFAULT_HASH_OFFSET;
 
   for (const char *ptr = (const char *)dataStart; ptr != dataEnd; ++ptr)
-      hash += (hash << 5) + hash + *ptr;
+      hash += (hash << 5) + hash + (hash_t)*ptr;
+
+  return hash;
+}
+
+hash_t getWordHash(const void *dataStart, const void *dataEnd)
+{
+  if (!isPointerCorrect(dataStart) || !isPointerCorrect(dataEnd))
+    return 0;
+
+  const char *data = (const char *)dataStart;
+
+  size_t size = (size_t)((const char *)dataEnd - data);
+
+  unsigned long long hash = DEFAULT_HASH_OFFSET ^ (size*WORD_HASH_MULTIPLIER);
+
+  unsigned long long word = 0;
+
+  for ( ; size >= sizeof(word); data += sizeof(word), size -= sizeof(word))
+    {
+      memcpy(&word, data, sizeof(word));
+
+      hash = mixWord(hash, word);
+    }
+
+  if (size)
+    {
+      word = 0;
+
+      memcpy(&word, data, size);
+
+      hash = mixWord(hash, word);
+    }
+
+  return (hash_t)(hash ^ (hash >> 32));
+}
+
+hash_t getSimdHash(const void *dataStart, const void *dataEnd)
+{
+  if (!isPointerCorrect(dataStart) || !isPointerCorrect(dataEnd))
+    return 0;
+
+  static const int HAS_AVX2 = isCpuSupports("avx2");
+
+  const char *data = (const char *)dataStart;
+
+  size_t size = (size_t)((const char *)dataEnd - data);
+
+  hash_t lanes[SIMD_HASH_LANES] = {};
+
+  for (size_t i = 0; i < SIMD_HASH_LANES; ++i)
+    lanes[i] = DEFAULT_HASH_OFFSET + (hash_t)i;
+
+  size_t stripes = size / SIMD_HASH_STRIPE;
+
+  if (HAS_AVX2)
+    hashSimdLanesAvx2(lanes, data, stripes);
+  else
+    hashSimdLanes    (lanes, data, stripes);
+
+  data += stripes*SIMD_HASH_STRIPE;
+
+  hash_t hash = foldSimdLanes(lanes, size);
+
+  for ( ; data < (const char *)dataEnd; data += sizeof(hash_t))
+    {
+      hash_t word = 0;
+
+      size_t wordSize = (size_t)((const char *)dataEnd - data);
+
+      memcpy(&word, data, wordSize < sizeof(word) ? wordSize : sizeof(word));
+
+      hash = mixLane(hash, word);
+    }
+
+  return hash;
+}
+
+hash_t getCrc32cHash(const void *dataStart, const void *dataEnd)
+{
+  if (!isPointerCorrect(dataStart) || !isPointerCorrect(dataEnd))
+    return 0;
+
+  static const int HAS_SSE42 = isCpuSupports("sse4.2");
+
+  const char *data = (const char *)dataStart;
+
+  size_t size = (size_t)((const char *)dataEnd - data);
+
+  if (HAS_SSE42)
+    return getCrc32cSse42   (data, size);
+
+  return   getCrc32cSoftware(data, size);
+}
+
+hash_function_t getHashFunction(HashKind kind)
+{
+  switch (kind)
+    {
+    case HASH_BYTE:   return getHash;
+    case HASH_WORD:   return getWordHash;
+    case HASH_SIMD:   return getSimdHash;
+    case HASH_CRC32C: return getCrc32cHash;
+    default:          return getHash;
+    }
+}
+
+hash_t getCellHash(const void *cellStart, const void *cellEnd, size_t cellIndex,
+                   hash_function_t hashFunction)
+{
+  return mixCellIndex(hashFunction(cellStart, cellEnd), cellIndex);
+}
+
+hash_t getCellsHash(const void *cells, size_t cellSize, size_t cellCount, size_t firstIndex, HashKind kind)
+{
+  if (!isPointerCorrect(cells) || !cellSize)
+    return nullhash;
+
+  static const int HAS_AVX2 = isCpuSupports("avx2");
+
+  const char *cell = (const char *)cells;
+
+  hash_t hash = nullhash;
+
+  if (kind == HASH_SIMD && HAS_AVX2 && cellSize < SIMD_HASH_STRIPE && cellSize % sizeof(hash_t) == 0)
+    {
+      size_t vectorCells = cellCount - cellCount % SIMD_HASH_LANES;
+
+      hash += getSimdCellsHashAvx2(cell, cellSize, vectorCells, firstIndex);
+
+      cell       += vectorCells*cellSize;
+      firstIndex += vectorCells;
+      cellCount  -= vectorCells;
+    }
+
+  hash_function_t hashFunction = getHashFunction(kind);
+
+  for (size_t i = 0; i < cellCount; ++i, cell += cellSize)
+    hash += getCellHash(cell, cell + cellSize, firstIndex + i, hashFunction);
+
+  return hash;
+}
+
+static constexpr Crc32cTable createCrc32cTable()
+{
+  Crc32cTable table = {};
+
+  for (hash_t i = 0; i < 256; ++i)
+    {
+      hash_t crc = i;
+
+      for (int bit = 0; bit < 8; ++bit)
+        crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLYNOMIAL : crc >> 1;
+
+      table.value[i] = crc;
+    }
+
+  return table;
+}
+
+static unsigned long long mixWord(unsigned long long hash, unsigned long long word)
+{
+  hash = (hash ^ word)*WORD_HASH_MULTIPLIER;
+
+  return hash ^ (hash >> 29);
+}
+
+static hash_t mixLane(hash_t lane, hash_t word)
+{
+  lane = (lane ^ word)*SIMD_LANE_MULTIPLIER;
+
+  return lane ^ (lane >> 15);
+}
+
+static hash_t mixCellIndex(hash_t hash, size_t cellIndex)
+{
+  hash ^= (hash_t)cellIndex * CELL_INDEX_MULTIPLIER;
+  hash *= CELL_MIX_MULTIPLIER;
+
+  return hash ^ (hash >> 13);
+}
+
+static void hashSimdLanes(hash_t *lanes, const char *data, size_t stripes)
+{
+  for (size_t i = 0; i < stripes; ++i, data += SIMD_HASH_STRIPE)
+    for (size_t j = 0; j < SIMD_HASH_LANES; ++j)
+      {
+        hash_t word = 0;
+
+        memcpy(&word, data + j*sizeof(hash_t), sizeof(hash_t));
+
+        lanes[j] = mixLane(lanes[j], word);
+      }
+}
+
+__attribute__((target("avx2")))
+static void hashSimdLanesAvx2(hash_t *lanes, const char *data, size_t stripes)
+{
+  __m256i hash       = _mm256_loadu_si256((const __m256i *)lanes);
+  __m256i multiplier = _mm256_set1_epi32((int)SIMD_LANE_MULTIPLIER);
+
+  for (size_t i = 0; i < stripes; ++i, data += SIMD_HASH_STRIPE)
+    {
+      __m256i word = _mm256_loadu_si256((const __m256i *)data);
+
+      hash = _mm256_mullo_epi32(_mm256_xor_si256(hash, word), multiplier);
+      hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 15));
+    }
+
+  _mm256_storeu_si256((__m256i *)lanes, hash);
+}
+
+static hash_t foldSimdLanes(const hash_t *lanes, size_t size)
+{
+  hash_t hash = (hash_t)size;
+
+  for (size_t i = 0; i < SIMD_HASH_LANES; ++i)
+    {
+      hash = (hash ^ lanes[i])*CELL_MIX_MULTIPLIER;
+      hash ^= hash >> 15;
+    }
+
+  return hash;
+}
+
+__attribute__((target("avx2")))
+static hash_t getSimdCellsHashAvx2(const char *cells, size_t cellSize, size_t cellCount, size_t firstIndex)
+{
+  hash_t lanes[SIMD_HASH_LANES] = {};
+
+  for (size_t i = 0; i < SIMD_HASH_LANES; ++i)
+    lanes[i] = DEFAULT_HASH_OFFSET + (hash_t)i;
+
+  size_t cellWords = cellSize / sizeof(hash_t);
+
+  __m256i start      = _mm256_set1_epi32((int)foldSimdLanes(lanes, cellSize));
+  __m256i multiplier = _mm256_set1_epi32((int)SIMD_LANE_MULTIPLIER);
+  __m256i indexStep  = _mm256_set1_epi32((int)(SIMD_HASH_LANES*CELL_INDEX_MULTIPLIER));
+  __m256i mix        = _mm256_set1_epi32((int)CELL_MIX_MULTIPLIER);
+  __m256i offsets    = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                          _mm256_set1_epi32((int)cellWords));
+  __m256i indexes    = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                           _mm256_set1_epi32((int)firstIndex)),
+                                          _mm256_set1_epi32((int)CELL_INDEX_MULTIPLIER));
+  __m256i sum        = _mm256_setzero_si256();
+
+  for (size_t i = 0; i < cellCount; i += SIMD_HASH_LANES, cells += SIMD_HASH_LANES*cellSize)
+    {
+      __m256i hash = start;
+
+      for (size_t j = 0; j < cellWords; ++j)
+        {
+          __m256i word = _mm256_i32gather_epi32((const int *)(const void *)cells + j, offsets, sizeof(hash_t));
+
+          hash = _mm256_mullo_epi32(_mm256_xor_si256(hash, word), multiplier);
+          hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 15));
+        }
+
+      hash = _mm256_mullo_epi32(_mm256_xor_si256(hash, indexes), mix);
+      hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 13));
+
+      sum     = _mm256_add_epi32(sum, hash);
+      indexes = _mm256_add_epi32(indexes, indexStep);
+    }
+
+  _mm256_storeu_si256((__m256i *)lanes, sum);
+
+  hash_t hash = nullhash;
+
+  for (size_t i = 0; i < SIMD_HASH_LANES; ++i)
+    hash += lanes[i];
+
+  return hash;
+}
+
+static hash_t getCrc32cSoftware(const char *data, size_t size)
+{
+  hash_t crc = CRC32C_START;
+
+  for (size_t i = 0; i < size; ++i)
+    crc = CRC32C_TABLE.value[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+
+  return ~crc;
+}
+
+__attribute__((target("sse4.2")))
+static hash_t getCrc32cSse42(const char *data, size_t size)
+{
+  unsigned long long crc = CRC32C_START;
+
+  for ( ; size >= sizeof(crc); data += sizeof(crc), size -= sizeof(crc))
+    {
+      unsigned long long word = 0;
+
+      memcpy(&word, data, sizeof(word));
+
+      crc = _mm_crc32_u64(crc, word);
+    }
+
+  unsigned crc32 = (unsigned)crc;
+
+  for ( ; size; ++data, --size)
+    crc32 = _mm_crc32_u8(crc32, (unsigned char)*data);
+
+  return ~crc32;
+}
+
+static int isCpuSupports(const char *instructionSet)
+{
+  __builtin_cpu_init();
+
+  if (!strcmp(instructionSet, "avx2"))
+    return __builtin_cpu_supports("avx2");
+
+  if (!strcmp(instructionSet, "sse4.2"))
+    return __builtin_cpu_supports("sse4.2");
 
-  return (hash_t)hash;
+  return 0;
 }
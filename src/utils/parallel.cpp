@@ -0,0 +1,379 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "parallel.h"
+
+/// Size of cache line in bytes, ranges of workers are on different lines
+const size_t WORKER_ALIGNMENT = 64;
+
+/// Mask of first task in ParallelWorker::range
+const unsigned long long RANGE_BEGIN_MASK = 0xFFFFFFFFull;
+
+/// Shift of end of tasks in ParallelWorker::range
+const unsigned RANGE_END_SHIFT = 32;
+
+/// Tasks of one thread of runParallel()
+struct ParallelWorker {
+  alignas(WORKER_ALIGNMENT) unsigned long long range; /// <- End of tasks in high 32 bits and
+                                                      ///    next task in low 32 bits
+};
+
+/// Max count of threads of pool of runParallel(), calling thread isn`t in pool
+const size_t MAX_POOL_THREAD_COUNT = 256;
+
+/// Job of runParallel()
+struct ParallelContext {
+  parallel_task_t  task;        /// <- Function of task
+  void            *argument;    /// <- Argument of task
+  ParallelWorker  *workers;     /// <- Ranges of tasks of threads
+  size_t           workerCount; /// <- Count of workers, worker 0 is calling thread
+};
+
+/// Threads which are created once and do jobs of all calls of runParallel()
+struct ParallelPool {
+  pthread_mutex_t  jobLock;      /// <- Held by runParallel() for whole job, so pool does one job at time
+  pthread_mutex_t  lock;         /// <- Protects fields below
+  pthread_cond_t   jobStarted;   /// <- Broadcast when ::generation is increased or pool is stopped
+  pthread_cond_t   jobFinished;  /// <- Signaled when ::busyCount becomes 0 or thread of pool starts
+  pthread_t       *threads;      /// <- Threads of pool
+  ParallelWorker  *workers;      /// <- Ranges of tasks of calling thread and threads of pool
+  size_t           threadCount;  /// <- Count of threads of pool
+  size_t           startedCount; /// <- Count of threads of pool which wait for jobs
+  ParallelContext *context;      /// <- Current job
+  size_t           generation;   /// <- Count of started jobs
+  size_t           busyCount;    /// <- Count of threads of pool which didn`t finish current job
+  int              isStopped;    /// <- Threads of pool have to exit
+};
+
+static ParallelPool POOL = {
+  .jobLock      = PTHREAD_MUTEX_INITIALIZER,
+  .lock         = PTHREAD_MUTEX_INITIALIZER,
+  .jobStarted   = PTHREAD_COND_INITIALIZER,
+  .jobFinished  = PTHREAD_COND_INITIALIZER,
+  .threads      = nullptr,
+  .workers      = nullptr,
+  .threadCount  = 0,
+  .startedCount = 0,
+  .context      = nullptr,
+  .generation   = 0,
+  .busyCount    = 0,
+  .isStopped    = 0
+};
+
+/// Count of threads of calls of runParallel() without it, 0 for getCoreCount()
+static size_t DEFAULT_THREAD_COUNT = 0;
+
+/// Pack range of tasks [begin, end)
+static unsigned long long makeRange(size_t begin, size_t end);
+
+/// Take first task of own range
+/// @return 1 if task was taken else 0
+static int takeTask(ParallelWorker *worker, size_t *task);
+
+/// Take second half of range of other worker, first task of it is returned and rest becomes own range
+/// @return 1 if task was stolen else 0
+static int stealTasks(ParallelWorker *thief, ParallelWorker *victim, size_t *task);
+
+/// Do own tasks and steal tasks of other workers until all ranges are empty
+static void doTasks(ParallelContext *context, size_t worker);
+
+/// Create threads of pool until there are threadCount of them, it is called under POOL.jobLock
+/// @return Count of threads of pool
+static size_t growPool(size_t threadCount);
+
+/// Wait for jobs of pool and do them
+static void *runPoolThread(void *thread);
+
+/// Stop and join threads of pool at exit
+static void stopPool();
+
+size_t getCoreCount()
+{
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return (cores > 0) ? (size_t)cores : 1;
+}
+
+void setParallelThreadCount(size_t threadCount)
+{
+  __atomic_store_n(&DEFAULT_THREAD_COUNT, threadCount, __ATOMIC_RELAXED);
+}
+
+size_t getParallelThreadCount()
+{
+  size_t threadCount = __atomic_load_n(&DEFAULT_THREAD_COUNT, __ATOMIC_RELAXED);
+
+  return threadCount ? threadCount : getCoreCount();
+}
+
+size_t getParallelJobCount()
+{
+  pthread_mutex_lock(&POOL.lock);
+
+  size_t jobCount = POOL.generation;
+
+  pthread_mutex_unlock(&POOL.lock);
+
+  return jobCount;
+}
+
+int runParallel(parallel_task_t task, void *argument, size_t taskCount, size_t threadCount)
+{
+  if (!task || taskCount > RANGE_BEGIN_MASK)
+    return -1;
+
+  if (!threadCount)
+    threadCount = getParallelThreadCount();
+
+  if (threadCount > taskCount)
+    threadCount = taskCount;
+
+  if (threadCount > 1 && pthread_mutex_trylock(&POOL.jobLock))
+    threadCount = 1;
+
+  if (threadCount <= 1)
+    {
+      for (size_t i = 0; i < taskCount; ++i)
+        task(argument, i);
+
+      return 0;
+    }
+
+  threadCount = growPool(threadCount - 1) + 1;
+
+  if (threadCount > 1)
+    {
+      ParallelContext context = {
+        .task        = task,
+        .argument    = argument,
+        .workers     = POOL.workers,
+        .workerCount = threadCount
+      };
+
+      for (size_t i = 0; i < threadCount; ++i)
+        POOL.workers[i].range = makeRange(i*taskCount / threadCount, (i + 1)*taskCount / threadCount);
+
+      pthread_mutex_lock(&POOL.lock);
+
+      POOL.context   = &context;
+      POOL.busyCount = POOL.threadCount;
+
+      ++POOL.generation;
+
+      pthread_cond_broadcast(&POOL.jobStarted);
+      pthread_mutex_unlock(&POOL.lock);
+
+      doTasks(&context, 0);
+
+      pthread_mutex_lock(&POOL.lock);
+
+      while (POOL.busyCount)
+        pthread_cond_wait(&POOL.jobFinished, &POOL.lock);
+
+      POOL.context = nullptr;
+
+      pthread_mutex_unlock(&POOL.lock);
+    }
+  else
+    for (size_t i = 0; i < taskCount; ++i)
+      task(argument, i);
+
+  pthread_mutex_unlock(&POOL.jobLock);
+
+  return 0;
+}
+
+static unsigned long long makeRange(size_t begin, size_t end)
+{
+  return (unsigned long long)end << RANGE_END_SHIFT | begin;
+}
+
+static int takeTask(ParallelWorker *worker, size_t *task)
+{
+  unsigned long long range = __atomic_load_n(&worker->range, __ATOMIC_ACQUIRE);
+
+  while (true)
+    {
+      size_t begin = range & RANGE_BEGIN_MASK;
+      size_t end   = range >> RANGE_END_SHIFT;
+
+      if (begin >= end)
+        return 0;
+
+      if (__atomic_compare_exchange_n(&worker->range, &range, makeRange(begin + 1, end), true,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+          *task = begin;
+
+          return 1;
+        }
+    }
+}
+
+static int stealTasks(ParallelWorker *thief, ParallelWorker *victim, size_t *task)
+{
+  unsigned long long range = __atomic_load_n(&victim->range, __ATOMIC_ACQUIRE);
+
+  while (true)
+    {
+      size_t begin = range & RANGE_BEGIN_MASK;
+      size_t end   = range >> RANGE_END_SHIFT;
+
+      if (begin >= end)
+        return 0;
+
+      size_t middle = begin + (end - begin) / 2;
+
+      if (__atomic_compare_exchange_n(&victim->range, &range, makeRange(begin, middle), true,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+          __atomic_store_n(&thief->range, makeRange(middle + 1, end), __ATOMIC_RELEASE);
+
+          *task = middle;
+
+          return 1;
+        }
+    }
+}
+
+static void doTasks(ParallelContext *context, size_t worker)
+{
+  ParallelWorker *workers = context->workers;
+
+  size_t task = 0;
+
+  while (true)
+    {
+      while (takeTask(&workers[worker], &task))
+        context->task(context->argument, task);
+
+      int isStolen = 0;
+
+      for (size_t i = 1; i < context->workerCount && !isStolen; ++i)
+        isStolen = stealTasks(&workers[worker], &workers[(worker + i) % context->workerCount], &task);
+
+      if (!isStolen)
+        return;
+
+      context->task(context->argument, task);
+    }
+}
+
+static size_t growPool(size_t threadCount)
+{
+  if (threadCount > MAX_POOL_THREAD_COUNT)
+    threadCount = MAX_POOL_THREAD_COUNT;
+
+  if (POOL.isStopped || threadCount <= POOL.threadCount)
+    return POOL.threadCount;
+
+  pthread_t      *threads = (pthread_t *)realloc(POOL.threads, threadCount*sizeof(pthread_t));
+  ParallelWorker *workers = (ParallelWorker *)aligned_alloc(WORKER_ALIGNMENT,
+                                                            (threadCount + 1)*sizeof(ParallelWorker));
+
+  if (threads)
+    POOL.threads = threads;
+
+  if (!threads || !workers)
+    {
+      free(workers);
+
+      return POOL.threadCount;
+    }
+
+  free(POOL.workers);
+
+  POOL.workers = workers;
+
+  if (!POOL.threadCount)
+    atexit(stopPool);
+
+  while (POOL.threadCount < threadCount)
+    {
+      pthread_mutex_lock(&POOL.lock);
+
+      int error = pthread_create(&POOL.threads[POOL.threadCount], nullptr, runPoolThread,
+                                 (void *)(POOL.threadCount + 1));
+
+      if (!error)
+        ++POOL.threadCount;
+
+      pthread_mutex_unlock(&POOL.lock);
+
+      if (error)
+        break;
+    }
+
+  pthread_mutex_lock(&POOL.lock);
+
+  while (POOL.startedCount < POOL.threadCount)
+    pthread_cond_wait(&POOL.jobFinished, &POOL.lock);
+
+  pthread_mutex_unlock(&POOL.lock);
+
+  return POOL.threadCount;
+}
+
+static void *runPoolThread(void *thread)
+{
+  size_t worker = (size_t)thread;
+
+  pthread_mutex_lock(&POOL.lock);
+
+  size_t generation = POOL.generation;
+
+  ++POOL.startedCount;
+
+  pthread_cond_signal(&POOL.jobFinished);
+
+  while (true)
+    {
+      while (!POOL.isStopped && POOL.generation == generation)
+        pthread_cond_wait(&POOL.jobStarted, &POOL.lock);
+
+      if (POOL.isStopped)
+        break;
+
+      generation = POOL.generation;
+
+      ParallelContext *context = POOL.context;
+
+      pthread_mutex_unlock(&POOL.lock);
+
+      if (worker < context->workerCount)
+        doTasks(context, worker);
+
+      pthread_mutex_lock(&POOL.lock);
+
+      if (!--POOL.busyCount)
+        pthread_cond_signal(&POOL.jobFinished);
+    }
+
+  pthread_mutex_unlock(&POOL.lock);
+
+  return nullptr;
+}
+
+static void stopPool()
+{
+  pthread_mutex_lock(&POOL.jobLock);
+  pthread_mutex_lock(&POOL.lock);
+
+  POOL.isStopped = 1;
+
+  pthread_cond_broadcast(&POOL.jobStarted);
+  pthread_mutex_unlock(&POOL.lock);
+
+  for (size_t i = 0; i < POOL.threadCount; ++i)
+    pthread_join(POOL.threads[i], nullptr);
+
+  free(POOL.threads);
+  free(POOL.workers);
+
+  POOL.threads     = nullptr;
+  POOL.workers     = nullptr;
+  POOL.threadCount  = 0;
+  POOL.startedCount = 0;
+
+  pthread_mutex_unlock(&POOL.jobLock);
+}
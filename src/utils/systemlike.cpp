@@ -2,7 +2,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <time.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 #include "systemlike.h"
 
 #pragma GCC diagnostic ignored "-Wcast-qual"
@@ -21,6 +26,116 @@ void *recalloc(void *pointer, size_t elements, size_t elementSize)
   return newPointer;
 }
 
+void *mapRealloc(void *pointer, size_t oldSize, size_t newSize)
+{
+  void *newPointer = pointer ?
+    mremap(pointer, oldSize, newSize, MREMAP_MAYMOVE) :
+    mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (newPointer == MAP_FAILED)
+    return nullptr;
+
+  return newPointer;
+}
+
+void mapFree(void *pointer, size_t size)
+{
+  if (pointer)
+    munmap(pointer, size);
+}
+
+int writeFull(int fileDescriptor, const void *buffer, size_t size)
+{
+  const char *curr = (const char *)buffer;
+
+  while (size)
+    {
+      ssize_t written = write(fileDescriptor, curr, size);
+
+      if (written <= 0)
+        return -1;
+
+      curr += written;
+      size -= (size_t)written;
+    }
+
+  return 0;
+}
+
+int futexWait(unsigned *address, unsigned value)
+{
+  return syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0) ? -1 : 0;
+}
+
+int futexWake(unsigned *address, int count)
+{
+  return (int)syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+int syncDirectory(const char *fileName)
+{
+  if (!isPointerCorrect(fileName))
+    return -1;
+
+  const char *slash = strrchr(fileName, '/');
+
+  char *directory = slash ? strndup(fileName, (size_t)(slash - fileName) + 1) : strdup(".");
+
+  if (!directory)
+    return -1;
+
+  int fileDescriptor = open(directory, O_RDONLY | O_DIRECTORY);
+
+  free(directory);
+
+  if (fileDescriptor == -1)
+    return -1;
+
+  int error = fsync(fileDescriptor);
+
+  if (close(fileDescriptor))
+    error = -1;
+
+  return error ? -1 : 0;
+}
+
+unsigned long long getMonotonicTime()
+{
+  timespec time = {};
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return (unsigned long long)time.tv_sec*1000000000ull + (unsigned long long)time.tv_nsec;
+}
+
+void *mapFile(const char *fileName, size_t *size)
+{
+  if (!isPointerCorrect(fileName) || !isPointerCorrect(size))
+    return nullptr;
+
+  int fileDescriptor = open(fileName, O_RDONLY);
+
+  if (fileDescriptor == -1)
+    return nullptr;
+
+  struct stat temp = {};
+
+  void *pointer = MAP_FAILED;
+
+  if (fstat(fileDescriptor, &temp) != -1 && temp.st_size > 0)
+    pointer = mmap(nullptr, (size_t)temp.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                   fileDescriptor, 0);
+
+  close(fileDescriptor);
+
+  if (pointer == MAP_FAILED)
+    return nullptr;
+
+  *size = (size_t)temp.st_size;
+
+  return pointer;
+}
+
 int isPointerWriteCorrect(const void *pointer)
 {
   if (!pointer)
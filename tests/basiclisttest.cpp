@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "list.h"
+#include "asserts.h"
+
+#pragma GCC diagnostic ignored "-Wlarger-than="
+
+/// Element of list of test which is bigger than int and is aligned by 8 with its Node
+struct Point {
+  int x; /// <- Key of sort
+  int y; /// <- Value which checks that element is moved whole
+};
+
+template <>
+struct ElementTraits<Point> {
+  /// Value of free cells
+  static Point poison()
+  {
+    return Point {.x = -1, .y = -1};
+  }
+
+  /// Element as C-like string in buffer of calling thread
+  static char *toString(const Point &element)
+  {
+    static thread_local char buff[32] = "";
+
+    snprintf(buff, sizeof(buff), "(%d, %d)", element.x, element.y);
+
+    return buff;
+  }
+};
+
+/// List of test which isn`t default List
+typedef BasicList<Point, long long> PointList;
+
+/// Count of elements in lists of test
+const int TEST_SIZE = 20000;
+
+/// Step of removed elements
+const int REMOVE_STEP = 7;
+
+/// Name of file of saved list
+const char *const TEST_FILE_NAME = "basiclisttest.lst";
+
+/// Push points from 0 to count to back of list, odd ones to front
+static void fillList(PointList *list, int count);
+
+/// Comparator of points by x
+static int comparePoints(const Point *first, const Point *second);
+
+/// Check that elements are sorted by x, each of them is whole and list is linear
+static void checkSorted(const PointList *list);
+
+/// Save list to file, map copy of it and check that copy has the same Nodes
+static void checkFile(const PointList *list);
+
+int main()
+{
+  const ListStorage storages[] = {LIST_STORAGE_AOS, LIST_STORAGE_SOA, LIST_STORAGE_CHUNKED};
+
+  for (size_t i = 0; i < sizeof(storages) / sizeof(storages[0]); ++i)
+    {
+      int error = 0;
+
+      PointList list = {};
+
+      initList(&list, 10, &error, storages[i]);
+
+      assert(!error);
+
+      fillList(&list, TEST_SIZE);
+
+      if (list.storage == LIST_STORAGE_AOS)
+        assert((uintptr_t)list.data % alignof(BasicNode<Point, long long>) == 0);
+
+      Point point = {};
+
+      for (long long index = REMOVE_STEP; index <= TEST_SIZE; index += REMOVE_STEP)
+        {
+          list_removeElement(&list, index, &point, &error);
+
+          assert(!error && point.y == -point.x);
+        }
+
+      list_moveRange(&list, list_head(&list), list_next(&list, list_head(&list)), list_tail(&list), &error);
+
+      assert(!error);
+      assert(validateList(&list, LIST_VALIDATE_DEEP) == 0);
+
+      list_sort(&list, comparePoints, &error);
+
+      assert(!error);
+
+      checkSorted(&list);
+
+      if (list.storage == LIST_STORAGE_AOS)
+        checkFile(&list);
+
+      destroyList(&list, &error);
+
+      assert(!error);
+    }
+
+  int error = 0;
+
+  List list = {};
+
+  initList(&list, 10, &error);
+
+  for (int i = 0; i < TEST_SIZE; ++i)
+    {
+      index_t index = list_pushBackElement(&list, &i, &error);
+
+      assert(index == i + 1 && !error);
+    }
+
+  assert(validateList(&list, LIST_VALIDATE_DEEP) == 0);
+
+  destroyList(&list, &error);
+
+  assert(!error);
+
+  printf("basiclisttest: OK\n");
+
+  return 0;
+}
+
+static void fillList(PointList *list, int count)
+{
+  int error = 0;
+
+  for (int i = 0; i < count; ++i)
+    {
+      Point point = {.x = i, .y = -i};
+
+      long long index = (i % 2) ? list_pushFrontElement(list, &point, &error) :
+                                  list_pushBackElement (list, &point, &error);
+
+      assert(index == i + 1 && !error);
+    }
+
+  assert(list->size == (size_t)count);
+}
+
+static int comparePoints(const Point *first, const Point *second)
+{
+  return (first->x > second->x) - (first->x < second->x);
+}
+
+static void checkSorted(const PointList *list)
+{
+  assert(list->isLinear);
+  assert(validateList(list, LIST_VALIDATE_DEEP) == 0);
+
+  int last = -1;
+
+  long long curr = list_head(list);
+
+  for (size_t i = 0; i < list->size; ++i, curr = list_next(list, curr))
+    {
+      const Point *point = list_element(list, curr);
+
+      assert(curr == (long long)i + 1);
+      assert(point->x > last && point->x % REMOVE_STEP != REMOVE_STEP - 1 && point->y == -point->x);
+
+      last = point->x;
+    }
+
+  assert(curr == nullindex);
+}
+
+static void checkFile(const PointList *list)
+{
+  int error = 0;
+
+  list_saveToFile(list, TEST_FILE_NAME, &error);
+
+  assert(!error);
+
+  PointList mapped = {};
+
+  list_mapFromFile(&mapped, TEST_FILE_NAME, &error);
+
+  assert(!error && mapped.size == list->size);
+  assert((uintptr_t)mapped.data % alignof(BasicNode<Point, long long>) == 0);
+  assert(validateList(&mapped, LIST_VALIDATE_DEEP) == 0);
+
+  for (long long curr = list_head(list), copy = list_head(&mapped); curr != nullindex;
+       curr = list_next(list, curr), copy = list_next(&mapped, copy))
+    {
+      assert(curr == copy);
+      assert(list_element(list, curr)->x == list_element(&mapped, copy)->x);
+    }
+
+  destroyList(&mapped, &error);
+
+  assert(!error);
+
+  remove(TEST_FILE_NAME);
+}
@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "list.h"
+#include "asserts.h"
+
+/// Count of elements in list of test, its data array is bigger than MAPPED_STORAGE_MIN_SIZE
+const int TEST_SIZE = 400000;
+
+/// Capacities of list after growths, each growth writes only one page above List::untouched
+/// (right canary of array)
+const size_t GROWN_CAPACITIES[] = {(size_t)1 << 22, (size_t)1 << 24, (size_t)1 << 25};
+
+/// Push elements from first to first + count to back of list
+static void fillList(List *list, int first, int count);
+
+/// Check that elements of list go from 0 to count - 1
+static void checkElements(const List *list, size_t count);
+
+/// Count of resident pages of memory from begin to end
+static size_t countResidentPages(const void *begin, const void *end);
+
+int main()
+{
+  int error = 0;
+
+  List list = {};
+
+  initList(&list, 10, &error);
+
+  fillList(&list, 0, TEST_SIZE);
+
+  assert(list.capacity*sizeof(Node) >= MAPPED_STORAGE_MIN_SIZE);
+
+  for (size_t i = 0; i < sizeof(GROWN_CAPACITIES) / sizeof(GROWN_CAPACITIES[0]); ++i)
+    {
+      list_resize(&list, GROWN_CAPACITIES[i], 0, &error);
+
+      assert(!error && list.capacity == GROWN_CAPACITIES[i]);
+      assert(list.untouched == (size_t)TEST_SIZE + 1);
+
+      checkElements(&list, TEST_SIZE);
+
+      assert(countResidentPages(list.data + list.untouched + 1, list.data + list.capacity - 1) <= i + 1);
+    }
+
+  fillList(&list, TEST_SIZE, TEST_SIZE);
+
+  checkElements(&list, 2*TEST_SIZE);
+
+  assert(list.untouched == 2*(size_t)TEST_SIZE + 1);
+
+  destroyList(&list);
+
+  printf("growthtest: OK\n");
+
+  return 0;
+}
+
+static void fillList(List *list, int first, int count)
+{
+  int error = 0;
+
+  for (int i = first; i < first + count; ++i)
+    {
+      index_t index = list_pushBackElement(list, &i, &error);
+
+      assert(index != nullindex && !error);
+    }
+}
+
+static void checkElements(const List *list, size_t count)
+{
+  assert(list->size == count);
+
+  index_t curr = list_head(list);
+
+  for (size_t i = 0; i < count; ++i, curr = list_next(list, curr))
+    assert(*list_element(list, curr) == (element_t)i);
+
+  assert(curr == nullindex);
+  assert(validateList(list, LIST_VALIDATE_DEEP) == 0);
+}
+
+static size_t countResidentPages(const void *begin, const void *end)
+{
+  size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+
+  uintptr_t first = ((uintptr_t)begin + pageSize - 1) / pageSize*pageSize;
+  uintptr_t last  = (uintptr_t)end / pageSize*pageSize;
+
+  if (first >= last)
+    return 0;
+
+  size_t pageCount = (last - first) / pageSize;
+
+  unsigned char *residency = (unsigned char *)calloc(pageCount, 1);
+
+  assert(residency);
+  assert(mincore((void *)first, last - first, residency) == 0);
+
+  size_t resident = 0;
+
+  for (size_t i = 0; i < pageCount; ++i)
+    resident += residency[i] & 1;
+
+  free(residency);
+
+  return resident;
+}
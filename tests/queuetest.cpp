@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "listqueue.h"
+#include "asserts.h"
+
+/// Count of cells of queues of test, it is small so producers wait for free cells
+const size_t QUEUE_CAPACITY = 64;
+
+/// Count of elements which are added by each producer
+const int PRODUCED_COUNT = 20000;
+
+/// Count of producers in LIST_QUEUE_MPSC test
+const int PRODUCER_COUNT = 4;
+
+/// Max count of elements taken by one listQueue_dequeueBatch()
+const size_t BATCH_SIZE = 16;
+
+/// Delay before listQueue_close() in nanoseconds, consumer waits for element during it
+const long CLOSE_DELAY = 50000000;
+
+/// Argument of producer thread
+struct Producer {
+  ListQueue *queue; /// <- Queue
+  int        id;    /// <- Index of producer, elements of it are from id*PRODUCED_COUNT
+};
+
+/// Check FIFO order, full and empty queue and wrap of positions in one thread
+static void testOneThread(ListQueue *queue);
+
+/// Run producers and check that consumer gets all elements of each of them in order
+static void testProducers(ListQueue *queue, int producerCount);
+
+/// Check that consumer gets elements added before close and then is woken by close
+static void testClose(ListQueue *queue);
+
+/// Add PRODUCED_COUNT elements of producer
+static void *produce(void *producer);
+
+/// Close queue after CLOSE_DELAY
+static void *closeLater(void *queue);
+
+int main()
+{
+  int error = 0;
+
+  ListQueue spsc = {};
+  ListQueue mpsc = {};
+
+  initListQueue(&spsc, QUEUE_CAPACITY, &error, LIST_QUEUE_SPSC);
+  initListQueue(&mpsc, QUEUE_CAPACITY, &error, LIST_QUEUE_MPSC);
+
+  assert(!error);
+
+  testOneThread(&spsc);
+  testOneThread(&mpsc);
+
+  testProducers(&spsc, 1);
+  testProducers(&mpsc, PRODUCER_COUNT);
+
+  testClose(&spsc);
+  testClose(&mpsc);
+
+  destroyListQueue(&spsc, &error);
+  destroyListQueue(&mpsc, &error);
+
+  assert(!error);
+
+  printf("queuetest: OK\n");
+
+  return 0;
+}
+
+static void testOneThread(ListQueue *queue)
+{
+  element_t element = 0;
+
+  assert(!listQueue_tryDequeue(queue, &element));
+  assert(listQueue_size(queue) == 0);
+
+  for (int round = 0; round < 3; ++round)
+    {
+      for (size_t i = 0; i < QUEUE_CAPACITY; ++i)
+        assert(listQueue_tryEnqueue(queue, (element_t)i));
+
+      assert(!listQueue_tryEnqueue(queue, -1));
+      assert(listQueue_size(queue) == QUEUE_CAPACITY);
+
+      element_t elements[BATCH_SIZE] = {};
+
+      assert(listQueue_dequeueBatch(queue, elements, BATCH_SIZE) == BATCH_SIZE);
+
+      for (size_t i = 0; i < BATCH_SIZE; ++i)
+        assert(elements[i] == (element_t)i);
+
+      for (size_t i = BATCH_SIZE; i < QUEUE_CAPACITY; ++i)
+        assert(listQueue_tryDequeue(queue, &element) && element == (element_t)i);
+
+      assert(!listQueue_tryDequeue(queue, &element));
+      assert(listQueue_size(queue) == 0);
+    }
+
+  assert(validateList(&queue->list, LIST_VALIDATE_DEEP) == 0);
+}
+
+static void testProducers(ListQueue *queue, int producerCount)
+{
+  pthread_t *threads   = (pthread_t *)calloc((size_t)producerCount, sizeof(pthread_t));
+  Producer  *producers = (Producer  *)calloc((size_t)producerCount, sizeof(Producer));
+  int       *expected  = (int       *)calloc((size_t)producerCount, sizeof(int));
+
+  assert(threads && producers && expected);
+
+  for (int i = 0; i < producerCount; ++i)
+    {
+      producers[i] = {.queue = queue, .id = i};
+
+      assert(pthread_create(&threads[i], nullptr, produce, &producers[i]) == 0);
+    }
+
+  long total = 0;
+
+  while (total < (long)producerCount*PRODUCED_COUNT)
+    {
+      element_t elements[BATCH_SIZE] = {};
+
+      size_t count = (total % 2) ? listQueue_dequeueBatch(queue, elements, BATCH_SIZE) :
+                                   (size_t)listQueue_dequeue(queue, elements);
+
+      assert(count);
+
+      for (size_t i = 0; i < count; ++i)
+        {
+          int producer = elements[i] / PRODUCED_COUNT;
+
+          assert(0 <= producer && producer < producerCount);
+          assert(elements[i] % PRODUCED_COUNT == expected[producer]);
+
+          ++expected[producer];
+        }
+
+      total += (long)count;
+    }
+
+  for (int i = 0; i < producerCount; ++i)
+    {
+      pthread_join(threads[i], nullptr);
+
+      assert(expected[i] == PRODUCED_COUNT);
+    }
+
+  assert(listQueue_size(queue) == 0);
+
+  free(threads);
+  free(producers);
+  free(expected);
+}
+
+static void testClose(ListQueue *queue)
+{
+  for (int i = 0; i < 3; ++i)
+    assert(listQueue_enqueue(queue, i));
+
+  pthread_t closer = {};
+
+  assert(pthread_create(&closer, nullptr, closeLater, queue) == 0);
+
+  element_t element = 0;
+
+  for (int i = 0; i < 3; ++i)
+    assert(listQueue_dequeue(queue, &element) && element == i);
+
+  assert(!listQueue_dequeue(queue, &element));
+
+  pthread_join(closer, nullptr);
+
+  assert(!listQueue_enqueue(queue, 0));
+  assert(!listQueue_tryEnqueue(queue, 0));
+}
+
+static void *produce(void *producer)
+{
+  Producer *self = (Producer *)producer;
+
+  for (int i = 0; i < PRODUCED_COUNT; ++i)
+    assert(listQueue_enqueue(self->queue, self->id*PRODUCED_COUNT + i));
+
+  return nullptr;
+}
+
+static void *closeLater(void *queue)
+{
+  timespec delay = {.tv_sec = 0, .tv_nsec = CLOSE_DELAY};
+
+  nanosleep(&delay, nullptr);
+
+  listQueue_close((ListQueue *)queue);
+
+  return nullptr;
+}
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+
+#include "list.h"
+#include "parallel.h"
+#include "asserts.h"
+
+/// Counts of threads of list functions in test, parallel ranking is tested on any machine
+const size_t THREAD_COUNTS[] = {1, 4};
+
+/// Count of jobs of parallel ranking, one measures sublists and one copies them
+const size_t RANKING_JOB_COUNT = 2;
+
+/// Count of elements in lists of test, head of list is on ruler after pushes to front
+const int TEST_SIZE = 2*(int)PARALLEL_RANKING_MIN_SIZE;
+
+/// Step of removed elements, their Nodes become holes in free sequence
+const int REMOVE_STEP = 7;
+
+/// Push elements from 0 to count to front of list, so they are in reversed order of Nodes
+static void fillList(List *list, int count);
+
+/// Remove every REMOVE_STEP-th element and move some of others from back to front
+static void shuffleList(List *list);
+
+/// Restore linearity of list and check that order of elements is kept and k-th element is in Node k
+/// @note Parallel ranking must be used if there are several threads
+static void checkRanking(List *list, size_t newCapacity);
+
+int main()
+{
+  const ListStorage storages[] = {LIST_STORAGE_AOS, LIST_STORAGE_SOA, LIST_STORAGE_CHUNKED};
+
+  for (size_t i = 0; i < sizeof(storages) / sizeof(storages[0]); ++i)
+    for (size_t j = 0; j < sizeof(THREAD_COUNTS) / sizeof(THREAD_COUNTS[0]); ++j)
+      {
+        setParallelThreadCount(THREAD_COUNTS[j]);
+
+        int error = 0;
+
+        List list = {};
+
+        initList(&list, 10, &error, storages[i]);
+
+        assert(!error);
+
+        fillList(&list, TEST_SIZE);
+
+        assert((size_t)list_head(&list) % RANKING_RULER_SPACING == 0);
+
+        checkRanking(&list, 0);
+
+        shuffleList(&list);
+
+        assert(list.size >= PARALLEL_RANKING_MIN_SIZE);
+
+        checkRanking(&list, list.size + 1);
+
+        destroyList(&list);
+      }
+
+  setParallelThreadCount(0);
+
+  printf("rankingtest: OK\n");
+
+  return 0;
+}
+
+static void fillList(List *list, int count)
+{
+  int error = 0;
+
+  for (int i = 0; i < count; ++i)
+    {
+      index_t index = list_pushFrontElement(list, &i, &error);
+
+      assert(index != nullindex && !error);
+    }
+}
+
+static void shuffleList(List *list)
+{
+  int error = 0;
+
+  element_t element = 0;
+
+  for (index_t index = REMOVE_STEP; index <= TEST_SIZE; index += REMOVE_STEP)
+    {
+      list_removeElement(list, index, &element, &error);
+
+      assert(!error);
+    }
+
+  for (int i = 0; i < TEST_SIZE / REMOVE_STEP; ++i)
+    {
+      list_popBackElement(list, &element, &error);
+
+      index_t index = list_pushFrontElement(list, &element, &error);
+
+      assert(index != nullindex && !error);
+    }
+
+  assert(!list->isLinear);
+}
+
+static void checkRanking(List *list, size_t newCapacity)
+{
+  int error = 0;
+
+  size_t size = list->size;
+
+  element_t *elements = (element_t *)calloc(size, sizeof(element_t));
+
+  assert(elements);
+
+  index_t curr = list_head(list);
+
+  for (size_t i = 0; i < size; ++i, curr = list_next(list, curr))
+    elements[i] = *list_element(list, curr);
+
+  size_t jobCount = getParallelJobCount();
+
+  list_restoreLinearity(list, newCapacity, &error);
+
+  assert(getParallelJobCount() - jobCount == ((getParallelThreadCount() > 1) ? RANKING_JOB_COUNT : 0));
+  assert(!error && list->isLinear && list->size == size);
+  assert(!newCapacity || list->capacity == newCapacity);
+
+  curr = list_head(list);
+
+  for (size_t i = 0; i < size; ++i, curr = list_next(list, curr))
+    {
+      assert(curr == (index_t)i + 1);
+      assert(*list_element(list, curr) == elements[i]);
+    }
+
+  assert(curr == nullindex);
+  assert(validateList(list, LIST_VALIDATE_DEEP) == 0);
+
+  free(elements);
+}
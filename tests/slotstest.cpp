@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "concurrentlist.h"
+#include "listslots.h"
+#include "asserts.h"
+
+/// Count of threads which share pool of slots
+const size_t THREAD_COUNT = 8;
+
+/// Count of operations of each thread
+const int ITERATION_COUNT = 5000;
+
+/// Max count of slots which are held by one thread at once
+const size_t HELD_SLOT_COUNT = 32;
+
+/// Count of slots in SlotStack of ABA test, it is less than count of threads
+const index_t STACK_SLOT_COUNT = 4;
+
+/// Max index of Node in test, it is enough for all inserted and held Nodes
+const size_t MAX_INDEX = 4*THREAD_COUNT*(ITERATION_COUNT + HELD_SLOT_COUNT);
+
+/// Shared state of threads of test
+struct SlotsTest {
+  ConcurrentList list;      /// <- List of test
+  SlotStack     *stack;     /// <- Stack of ABA test
+  unsigned char *owners;    /// <- Is slot held by some thread, it is indexed by index of Node
+  size_t         inserted;  /// <- Count of inserted slots
+  size_t         conflicts; /// <- Count of slots which were given to two threads at once
+};
+
+/// Take slot for calling thread, count conflict if slot is held by other thread
+static void takeOwnership(SlotsTest *test, index_t index);
+
+/// Give slot back, count conflict if slot isn`t held
+static void dropOwnership(SlotsTest *test, index_t index);
+
+/// Pop and push back slots of small stack, same slots are popped and pushed again by other threads
+static void *churnStack(void *test);
+
+/// Take slots from pool of list, insert some of them and release others
+static void *churnSlots(void *test);
+
+/// Start THREAD_COUNT threads with function and join them
+static void runThreads(void *(*function)(void *), SlotsTest *test);
+
+int main()
+{
+  int error = 0;
+
+  SlotsTest test = {};
+
+  test.owners = (unsigned char *)calloc(MAX_INDEX, sizeof(unsigned char));
+  test.stack  = createSlotStack();
+
+  assert(test.owners && test.stack);
+
+  for (index_t index = 1; index <= STACK_SLOT_COUNT; ++index)
+    assert(pushSlot(test.stack, index) == 0);
+
+  runThreads(churnStack, &test);
+
+  assert(test.conflicts == 0);
+  assert(getSlotCount(test.stack) == STACK_SLOT_COUNT);
+
+  for (index_t i = 0; i < STACK_SLOT_COUNT; ++i)
+    takeOwnership(&test, popSlot(test.stack));
+
+  assert(test.conflicts == 0);
+  assert(popSlot(test.stack) == nullindex);
+
+  destroySlotStack(test.stack);
+
+  for (index_t index = 1; index <= STACK_SLOT_COUNT; ++index)
+    dropOwnership(&test, index);
+
+  initConcurrentList(&test.list, 16, &error);
+
+  assert(!error);
+
+  runThreads(churnSlots, &test);
+
+  assert(test.conflicts == 0);
+
+  concurrentList_flushSlots(&test.list, &error);
+
+  assert(!error);
+  assert(getSlotCount(test.list.slots) == 0);
+  assert(test.list.list.reserved == 0);
+  assert(test.list.list.size == test.inserted);
+  assert(test.list.list.capacity <= MAX_INDEX);
+  assert(validateList(&test.list.list, LIST_VALIDATE_DEEP) == 0);
+
+  destroyConcurrentList(&test.list, &error);
+
+  free(test.owners);
+
+  printf("slotstest: OK\n");
+
+  return 0;
+}
+
+static void takeOwnership(SlotsTest *test, index_t index)
+{
+  assert(index > nullindex && (size_t)index < MAX_INDEX);
+
+  if (__atomic_exchange_n(&test->owners[index], 1, __ATOMIC_ACQ_REL))
+    __atomic_add_fetch(&test->conflicts, 1, __ATOMIC_RELAXED);
+}
+
+static void dropOwnership(SlotsTest *test, index_t index)
+{
+  assert(index > nullindex && (size_t)index < MAX_INDEX);
+
+  if (!__atomic_exchange_n(&test->owners[index], 0, __ATOMIC_ACQ_REL))
+    __atomic_add_fetch(&test->conflicts, 1, __ATOMIC_RELAXED);
+}
+
+static void *churnStack(void *test)
+{
+  SlotsTest *ctx = (SlotsTest *)test;
+
+  for (int i = 0; i < ITERATION_COUNT; ++i)
+    {
+      index_t index = popSlot(ctx->stack);
+
+      if (index == nullindex)
+        continue;
+
+      takeOwnership(ctx, index);
+      dropOwnership(ctx, index);
+
+      assert(pushSlot(ctx->stack, index) == 0);
+    }
+
+  return nullptr;
+}
+
+static void *churnSlots(void *test)
+{
+  SlotsTest *ctx = (SlotsTest *)test;
+
+  index_t held[HELD_SLOT_COUNT] = {};
+  size_t  heldCount = 0;
+
+  unsigned seed = (unsigned)(size_t)&held;
+
+  for (int i = 0; i < ITERATION_COUNT; ++i)
+    {
+      int operation = rand_r(&seed) % 4;
+
+      if (operation < 2 && heldCount < HELD_SLOT_COUNT)
+        {
+          int error = 0;
+
+          index_t index = concurrentList_allocSlot(&ctx->list, &error);
+
+          assert(!error && index != nullindex);
+
+          takeOwnership(ctx, index);
+
+          held[heldCount++] = index;
+        }
+      else if (heldCount)
+        {
+          index_t index = held[--heldCount];
+
+          dropOwnership(ctx, index);
+
+          int error = 0;
+
+          if (operation == 2)
+            {
+              element_t element = index;
+
+              concurrentList_insertSlot(&ctx->list, nullindex, index, &element, &error);
+
+              __atomic_add_fetch(&ctx->inserted, 1, __ATOMIC_RELAXED);
+            }
+          else
+            concurrentList_releaseSlot(&ctx->list, index, &error);
+
+          assert(!error);
+        }
+    }
+
+  while (heldCount)
+    {
+      dropOwnership(ctx, held[--heldCount]);
+
+      concurrentList_releaseSlot(&ctx->list, held[heldCount]);
+    }
+
+  return nullptr;
+}
+
+static void runThreads(void *(*function)(void *), SlotsTest *test)
+{
+  pthread_t threads[THREAD_COUNT] = {};
+
+  for (size_t i = 0; i < THREAD_COUNT; ++i)
+    assert(pthread_create(&threads[i], nullptr, function, test) == 0);
+
+  for (size_t i = 0; i < THREAD_COUNT; ++i)
+    pthread_join(threads[i], nullptr);
+}
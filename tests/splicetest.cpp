@@ -0,0 +1,205 @@
+#include <stdlib.h>
+
+#include "list.h"
+#include "liststorage.h"
+#include "asserts.h"
+
+/// Count of elements in lists of test
+const int TEST_SIZE = 50000;
+
+/// Push elements from first to first + count to back of list
+static void fillList(List *list, int first, int count);
+
+/// Check that elements of list are equal to values
+static void checkElements(const List *list, const int *values, size_t count);
+
+/// Copy of count Nodes of list from Node 0
+static Node *copyNodes(const List *list, size_t count);
+
+/// Count of Nodes which differ from copy
+static size_t countChangedNodes(const List *list, const Node *nodes, size_t count);
+
+/// Check that moves with anchor in range or last before first are rejected and don`t change list
+static void checkBadMoves(List *list);
+
+int main()
+{
+  int error = 0;
+
+  List first = {}, second = {};
+
+  initList(&first,  10, &error);
+  initList(&second, 10, &error, LIST_STORAGE_SOA);
+
+  fillList(&first,  0,          TEST_SIZE);
+  fillList(&second, TEST_SIZE,  TEST_SIZE);
+
+  checkBadMoves(&first);
+
+  Node *nodes = copyNodes(&first, first.capacity);
+
+  list_moveRange(&first, 10, TEST_SIZE - 10, TEST_SIZE, &error);
+
+  assert(!error);
+  assert(countChangedNodes(&first, nodes, first.capacity) <= 6);
+
+  checkBadMoves(&first);
+
+  list_enableOrderIndex(&first, 1, &error);
+
+  assert(!error);
+
+  checkBadMoves(&first);
+
+  list_enableOrderIndex(&first, 0, &error);
+
+  assert(!error);
+
+  int *values = (int *)calloc(3*TEST_SIZE, sizeof(int));
+
+  size_t count = 0;
+
+  for (int i = 0; i < 9; ++i)
+    values[count++] = i;
+
+  for (int i = TEST_SIZE - 10; i < TEST_SIZE; ++i)
+    values[count++] = i;
+
+  for (int i = 9; i < TEST_SIZE - 10; ++i)
+    values[count++] = i;
+
+  checkElements(&first, values, count);
+
+  free(nodes);
+
+  index_t last = list_head(&first);
+
+  for (int i = 0; i < 4999; ++i)
+    last = list_next(&first, last);
+
+  nodes = copyNodes(&second, second.capacity);
+
+  index_t moved = list_splice(&second, 100, &first, list_head(&first), last, &error);
+
+  assert(!error && moved != nullindex);
+  assert(countChangedNodes(&second, nodes, second.capacity) <= 5000 + 2);
+
+  int *expected = (int *)calloc(2*TEST_SIZE, sizeof(int));
+
+  for (int i = 0; i < 100; ++i)
+    expected[i] = TEST_SIZE + i;
+
+  for (int i = 0; i < 5000; ++i)
+    expected[100 + i] = values[i];
+
+  for (int i = 100; i < TEST_SIZE; ++i)
+    expected[5000 + i] = TEST_SIZE + i;
+
+  checkElements(&first,  values + 5000, TEST_SIZE - 5000);
+  checkElements(&second, expected,      TEST_SIZE + 5000);
+
+  list_split(&second, 100, &first, &error);
+
+  assert(!error);
+
+  for (int i = 0; i < TEST_SIZE + 4900; ++i)
+    values[TEST_SIZE + i] = expected[100 + i];
+
+  checkElements(&first,  values + 5000, 2*TEST_SIZE - 100);
+  checkElements(&second, expected,      100);
+
+  free(expected);
+  free(nodes);
+  free(values);
+
+  destroyList(&first);
+  destroyList(&second);
+
+  printf("splicetest: OK\n");
+
+  return 0;
+}
+
+static void fillList(List *list, int first, int count)
+{
+  int error = 0;
+
+  for (int i = first; i < first + count; ++i)
+    {
+      index_t index = list_pushBackElement(list, &i, &error);
+
+      assert(index != nullindex && !error);
+    }
+}
+
+static void checkElements(const List *list, const int *values, size_t count)
+{
+  assert(list->size == count);
+
+  index_t curr = list_head(list);
+
+  for (size_t i = 0; i < count; ++i, curr = list_next(list, curr))
+    assert(*list_element(list, curr) == values[i]);
+
+  assert(curr == nullindex);
+  assert(validateList(list, LIST_VALIDATE_DEEP) == 0);
+}
+
+static Node *copyNodes(const List *list, size_t count)
+{
+  Node *nodes = (Node *)calloc(count, sizeof(Node));
+
+  assert(nodes);
+
+  for (size_t i = 0; i < count; ++i)
+    nodes[i] = readNode(list, (index_t)i);
+
+  return nodes;
+}
+
+static size_t countChangedNodes(const List *list, const Node *nodes, size_t count)
+{
+  size_t changed = 0;
+
+  for (size_t i = 0; i < count && i < list->capacity; ++i)
+    {
+      Node node = readNode(list, (index_t)i);
+
+      if (node.elem != nodes[i].elem || node.next != nodes[i].next || node.prev != nodes[i].prev)
+        ++changed;
+    }
+
+  return changed;
+}
+
+static void checkBadMoves(List *list)
+{
+  index_t first = list_head(list);
+  index_t inner = first;
+
+  for (int i = 0; i < 50; ++i)
+    inner = list_next(list, inner);
+
+  index_t last = inner;
+
+  for (int i = 0; i < 50; ++i)
+    last = list_next(list, last);
+
+  Node *nodes = copyNodes(list, list->capacity);
+
+  int error = 0;
+
+  list_moveRange(list, first, last, inner, &error);
+
+  assert(error);
+
+  error = 0;
+
+  list_moveRange(list, last, first, nullindex, &error);
+
+  assert(error);
+  assert(countChangedNodes(list, nodes, list->capacity) == 0);
+  assert(validateList(list, LIST_VALIDATE_DEEP) == 0);
+
+  free(nodes);
+}
@@ -0,0 +1,227 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "list.h"
+#include "liststorage.h"
+#include "asserts.h"
+
+/// Count of elements pushed to lists of test
+const int TEST_SIZE = 1000;
+
+/// Step of removed elements, their Nodes make free sequence
+const int REMOVE_STEP = 3;
+
+/// Count of Nodes reserved by list_reserveSlots() in test
+const size_t RESERVED_COUNT = 5;
+
+/// Node::prev of first Node of free sequence
+const index_t FIRST_FREE_PREV = -1;
+
+/// Count of chunks of LIST_STORAGE_CHUNKED list of canary test
+const size_t CHUNK_COUNT = 3;
+
+/// Function which breaks list without update of hashes
+typedef void (*corruption_t)(List *list);
+
+/// Push TEST_SIZE elements and remove every REMOVE_STEP-th of them
+static void buildList(List *list, ListStorage storage);
+
+/// Build list, break it, rehash it so only links are broken and check result of deep validation
+/// @note Validation of list functions is disabled, so they don`t reject broken list before rehash
+static void checkCorruption(ListStorage storage, corruption_t corrupt, unsigned expected);
+
+/// Reserve slots, list stays correct
+static void reserveSlots(List *list);
+
+/// Reserve slots and break link of one of them, so it is lost
+static void leakReservedNode(List *list);
+
+/// Make cycle in free sequence
+static void makeFreeCycle(List *list);
+
+/// Break back link of second free Node
+static void breakFreeBackLink(List *list);
+
+/// Start free sequence from second free Node, so first one is lost
+static void leakFreeNode(List *list);
+
+/// Change count of reserved Nodes without reservation
+static void miscountReserved(List *list);
+
+/// Make cycle in main sequence
+static void makeMainCycle(List *list);
+
+/// Break right canary of middle chunk and check that only levels from LIST_VALIDATE_HASH find it
+static void checkChunkCanary();
+
+int main()
+{
+  const ListStorage storages[] = {LIST_STORAGE_AOS, LIST_STORAGE_SOA, LIST_STORAGE_CHUNKED};
+
+  for (size_t i = 0; i < sizeof(storages) / sizeof(storages[0]); ++i)
+    {
+      checkCorruption(storages[i], nullptr,           0);
+      checkCorruption(storages[i], reserveSlots,      0);
+      checkCorruption(storages[i], leakReservedNode,  LIST_FREE_SEQUENCE_IS_BROKEN);
+      checkCorruption(storages[i], makeFreeCycle,     LIST_FREE_SEQUENCE_IS_BROKEN);
+      checkCorruption(storages[i], breakFreeBackLink, LIST_FREE_SEQUENCE_IS_BROKEN);
+      checkCorruption(storages[i], leakFreeNode,      LIST_FREE_SEQUENCE_IS_BROKEN);
+      checkCorruption(storages[i], miscountReserved,  LIST_FREE_SEQUENCE_IS_BROKEN);
+      checkCorruption(storages[i], makeMainCycle,     LIST_MAIN_SEQUENCE_IS_BROKEN);
+    }
+
+#ifdef NEED_CANARY_
+
+  checkChunkCanary();
+
+#endif
+
+  printf("validationtest: OK\n");
+
+  return 0;
+}
+
+static void buildList(List *list, ListStorage storage)
+{
+  int error = 0;
+
+  initList(list, 10, &error, storage);
+
+  for (int i = 0; i < TEST_SIZE; ++i)
+    {
+      index_t index = list_pushBackElement(list, &i, &error);
+
+      assert(index != nullindex && !error);
+    }
+
+  element_t element = 0;
+
+  for (index_t index = REMOVE_STEP; index <= TEST_SIZE; index += REMOVE_STEP)
+    {
+      list_removeElement(list, index, &element, &error);
+
+      assert(!error);
+    }
+
+  assert(list->free != nullindex);
+}
+
+static void checkCorruption(ListStorage storage, corruption_t corrupt, unsigned expected)
+{
+  List list = {};
+
+  buildList(&list, storage);
+
+  list_setValidationLevel(&list, LIST_VALIDATE_NONE);
+
+  if (corrupt)
+    corrupt(&list);
+
+  list_setHashKind(&list, DEFAULT_HASH_KIND_);
+
+  assert(validateList(&list, LIST_VALIDATE_DEEP) == expected);
+
+  destroyList(&list);
+}
+
+static void reserveSlots(List *list)
+{
+  index_t slots[RESERVED_COUNT] = {};
+
+  list_reserveSlots(list, slots, RESERVED_COUNT);
+
+  assert(list->reserved == RESERVED_COUNT);
+}
+
+static void leakReservedNode(List *list)
+{
+  index_t slots[RESERVED_COUNT] = {};
+
+  list_reserveSlots(list, slots, RESERVED_COUNT);
+
+  Node node = readNode(list, slots[2]);
+
+  node.next = nullindex;
+
+  writeNode(list, slots[2], node);
+}
+
+static void makeFreeCycle(List *list)
+{
+  index_t second = readNode(list, list->free).next;
+  index_t third  = readNode(list, second).next;
+
+  Node node = readNode(list, third);
+
+  node.next = second;
+
+  writeNode(list, third, node);
+}
+
+static void breakFreeBackLink(List *list)
+{
+  index_t second = readNode(list, list->free).next;
+
+  Node node = readNode(list, second);
+
+  node.prev = FIRST_FREE_PREV;
+
+  writeNode(list, second, node);
+}
+
+static void leakFreeNode(List *list)
+{
+  index_t second = readNode(list, list->free).next;
+
+  Node node = readNode(list, second);
+
+  node.prev = FIRST_FREE_PREV;
+
+  writeNode(list, second, node);
+
+  list->free = second;
+}
+
+static void miscountReserved(List *list)
+{
+  list->reserved = 1;
+}
+
+static void makeMainCycle(List *list)
+{
+  index_t head   = list_head(list);
+  index_t second = list_next(list, head);
+
+  Node node = readNode(list, second);
+
+  node.next = head;
+
+  writeNode(list, second, node);
+}
+
+static void checkChunkCanary()
+{
+  int error = 0;
+
+  List list = {};
+
+  initList(&list, CHUNK_COUNT*STORAGE_CHUNK_SIZE, &error, LIST_STORAGE_CHUNKED);
+
+  assert(!error);
+
+  list_setValidationLevel(&list, LIST_VALIDATE_NONE);
+
+  Node *middle = list.chunks[CHUNK_COUNT / 2];
+
+  canary_t canary = 0;
+
+  memcpy(&canary, &middle[STORAGE_CHUNK_SIZE], sizeof(canary_t));
+  memset(&middle[STORAGE_CHUNK_SIZE], 0, sizeof(canary_t));
+
+  assert(validateList(&list, LIST_VALIDATE_FAST) == 0);
+  assert(validateList(&list, LIST_VALIDATE_HASH) == LIST_RIGHT_DATA_CANARY_DIED);
+
+  memcpy(&middle[STORAGE_CHUNK_SIZE], &canary, sizeof(canary_t));
+
+  destroyList(&list);
+}